@@ -0,0 +1,200 @@
+/*
+
+  u8g_font_aa.c
+
+  Host tool: convert a font of u8g_font_data.c (format 0 or 1) into an anti
+  aliased font (format 2) of half the size, see u8g_DrawAAStr()
+
+  Build and run (from this directory):
+    gcc -I../src/clib -DFONT=u8g_font_10x20 u8g_font_aa.c ../src/clib/u8g_font_data.c -o u8g_font_aa
+    ./u8g_font_aa > u8g_font_10x20_aa.c
+
+  Each pixel of the new font covers 2x2 pixel of the original font, the number
+  of set pixel (0..4) is mapped to the gray levels 0..3. Blocks are aligned to
+  the baseline and the origin, so all glyphs share the same grid.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "u8g.h"
+
+#ifndef FONT
+  #error "define FONT, e.g. -DFONT=u8g_font_10x20"
+#endif
+
+#define STR2(x) #x
+#define STR(x) STR2(x)
+
+#define HEADER_SIZE 17
+#define MAX_PIXEL (255 * 8)
+
+struct glyph {
+  int is_empty;
+  int w, h, dx, x, y;
+  uint8_t pixel[MAX_PIXEL];     // one byte per pixel, row by row, top row first
+};
+
+static struct glyph glyphs[256];
+static uint8_t out[65536];
+static int out_len;
+static int font_len;
+
+static void read_font(const uint8_t *font) {
+  int format = font[0];
+  int start = font[10], end = font[11];
+  const uint8_t *p = font + HEADER_SIZE;
+  int e, i, j, bpl, size;
+
+  if (format != 0 && format != 1) {
+    fprintf(stderr, "font format %d is not supported\n", format);
+    exit(1);
+  }
+  for ( e = start; e <= end; e++ ) {
+    struct glyph *g = glyphs + e;
+    const uint8_t *data;
+    if (p[0] == 255) {
+      g->is_empty = 1;
+      p++;
+      continue;
+    }
+    if (format == 0) {
+      g->w = p[0];
+      g->h = p[1];
+      size = p[2];
+      g->dx = (int8_t)p[3];
+      g->x = (int8_t)p[4];
+      g->y = (int8_t)p[5];
+      data = p + 6;
+    }
+    else {
+      g->x = p[0] >> 4;
+      g->y = (p[0] & 15) - 2;
+      g->w = p[1] >> 4;
+      g->h = p[1] & 15;
+      g->dx = p[2] >> 4;
+      size = p[2] & 15;
+      data = p + 3;
+    }
+    bpl = (g->w + 7) / 8;
+    for ( j = 0; j < g->h; j++ )
+      for ( i = 0; i < g->w; i++ )
+        g->pixel[j * g->w + i] = (data[j * bpl + i / 8] >> (7 - (i & 7))) & 1;
+    p = data + size;
+  }
+  font_len = p - font;
+}
+
+static int floor_half(int v) {
+  return v >= 0 ? v / 2 : -((1 - v) / 2);
+}
+
+// half of a font metric, rounded away from zero
+static int8_t half_metric(uint8_t v) {
+  int s = (int8_t)v;
+  return s >= 0 ? (s + 1) / 2 : -((1 - s) / 2);
+}
+
+// original pixel at column cx and row cy, both relative to the origin, y up
+static int get_pixel(const struct glyph *g, int cx, int cy) {
+  int i = cx - g->x;
+  int j = g->y + g->h - 1 - cy;
+  if (i < 0 || i >= g->w || j < 0 || j >= g->h)
+    return 0;
+  return g->pixel[j * g->w + i];
+}
+
+static void write_glyph(const struct glyph *g) {
+  static const uint8_t level[5] = { 0, 1, 2, 2, 3 };
+  int x0, x1, y0, y1, w, h, bpl, size, i, j, n;
+  uint8_t *data;
+
+  if (g->w == 0 || g->h == 0) {
+    x0 = 0; x1 = -1;
+    y0 = 0; y1 = -1;
+  }
+  else {
+    x0 = floor_half(g->x);
+    x1 = floor_half(g->x + g->w - 1);
+    y0 = floor_half(g->y);
+    y1 = floor_half(g->y + g->h - 1);
+  }
+  w = x1 - x0 + 1;
+  h = y1 - y0 + 1;
+  bpl = (w + 3) / 4;
+  size = bpl * h;
+  if (size > 255) {
+    fprintf(stderr, "a glyph exceeds 255 bytes\n");
+    exit(1);
+  }
+
+  out[out_len + 0] = w;
+  out[out_len + 1] = h;
+  out[out_len + 2] = size;
+  out[out_len + 3] = (g->dx + 1) / 2;
+  out[out_len + 4] = (uint8_t)x0;
+  out[out_len + 5] = (uint8_t)y0;
+  data = out + out_len + 6;
+  memset(data, 0, size);
+  for ( j = 0; j < h; j++ ) {
+    for ( i = 0; i < w; i++ ) {
+      int cx = 2 * (x0 + i), cy = 2 * (y1 - j);
+      n = get_pixel(g, cx, cy) + get_pixel(g, cx + 1, cy) + get_pixel(g, cx, cy + 1) + get_pixel(g, cx + 1, cy + 1);
+      data[j * bpl + i / 4] |= level[n] << (6 - 2 * (i & 3));
+    }
+  }
+  out_len += 6 + size;
+}
+
+static void write_font(const uint8_t *font) {
+  int start = font[10], end = font[11], e;
+  uint16_t pos65 = 0, pos97 = 0;
+
+  memcpy(out, font, HEADER_SIZE);
+  out[0] = 2;
+  out[1] = (font[1] + 1) / 2;           // bbx width and height
+  out[2] = (font[2] + 1) / 2;
+  out[3] = (uint8_t)floor_half((int8_t)font[3]);
+  out[4] = (uint8_t)floor_half((int8_t)font[4]);
+  out[5] = (font[5] + 1) / 2;           // capital A height
+  for ( e = 12; e <= 16; e++ )
+    out[e] = (uint8_t)half_metric(font[e]);
+  out_len = HEADER_SIZE;
+  for ( e = start; e <= end; e++ ) {
+    const struct glyph *g = glyphs + e;
+    if (e == 65) pos65 = out_len;
+    if (e == 97) pos97 = out_len;
+    if (g->is_empty) {
+      out[out_len++] = 255;
+      continue;
+    }
+    write_glyph(g);
+  }
+  // keep the shortcuts of the original font
+  if ((font[6] << 8 | font[7]) == 0) pos65 = 0;
+  if ((font[8] << 8 | font[9]) == 0) pos97 = 0;
+  out[6] = pos65 >> 8;
+  out[7] = pos65 & 255;
+  out[8] = pos97 >> 8;
+  out[9] = pos97 & 255;
+}
+
+int main(void) {
+  const uint8_t *font = FONT;
+  const char *name = STR(FONT);
+  int i;
+
+  read_font(font);
+  write_font(font);
+  fprintf(stderr, "%s: %d bytes, format 2: %d bytes\n", name, font_len, out_len);
+
+  printf("const u8g_fntpgm_uint8_t %s_aa[%d] U8G_FONT_SECTION(\"%s_aa\") = {", name, out_len, name);
+  for ( i = 0; i < out_len; i++ ) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", out[i], i + 1 < out_len ? (i % 16 == 15 ? "," : ", ") : "");
+  }
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,383 @@
+/*
+
+  u8g_font_range.c
+
+  Host tool: build a font of format 3 (16 bit encodings, sparse glyph ranges,
+  see u8g_font.c) from a font of u8g_font_data.c (format 0 or 1) and any number
+  of BDF files.
+
+  Build and run (from this directory):
+    gcc -I../src/clib -DFONT=u8g_font_6x10 u8g_font_range.c ../src/clib/u8g_font_data.c -o u8g_font_range
+    ./u8g_font_range u8g_font_sample.bdf > u8g_font_6x10_utf8.c
+
+  Options:
+    -n name       name of the array, default: FONT with "_utf8" appended
+    -r lo-hi      encodings taken from FONT, default: all, e.g. -r 32-126 for ASCII
+
+  The 8 bit encodings of FONT are used as 16 bit encodings (ISO 8859-1 is the
+  first block of Unicode). The glyphs of the BDF files are added, a glyph with
+  an encoding of FONT replaces it. Encodings with a gap of one missing glyph
+  are kept in one range, the empty index entry is smaller than another range.
+  Each glyph is found again with the binary search of u8g_font.c and compared
+  with the original before the font is written.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "u8g.h"
+
+#ifndef FONT
+  #error "define FONT, e.g. -DFONT=u8g_font_6x10"
+#endif
+
+#define STR2(x) #x
+#define STR(x) STR2(x)
+
+#define HEADER_SIZE 17
+#define RANGE_SIZE 6
+#define INDEX_SIZE 3
+#define MAX_RANGES 4096
+
+struct glyph {
+  int w, h, dx, x, y;
+  int size;                     // (w + 7) / 8 * h, at most 255
+  uint8_t data[255];            // rows of (w + 7) / 8 bytes, msb is the left pixel
+};
+
+static struct glyph *glyphs[0x10000];
+static uint8_t header[HEADER_SIZE];
+
+static int range_first[MAX_RANGES];
+static int range_last[MAX_RANGES];
+static int range_cnt;
+
+static uint8_t *out;
+static long out_len;
+
+static struct glyph *new_glyph(int encoding) {
+  if (glyphs[encoding] == NULL)
+    glyphs[encoding] = malloc(sizeof(struct glyph));
+  if (glyphs[encoding] == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memset(glyphs[encoding], 0, sizeof(struct glyph));
+  return glyphs[encoding];
+}
+
+static void read_font(const uint8_t *font, int lo, int hi) {
+  int format = font[0];
+  int start = font[10], end = font[11];
+  const uint8_t *p = font + HEADER_SIZE;
+  const uint8_t *data;
+  int e, w, h, dx, x, y, size;
+
+  if (format != 0 && format != 1) {
+    fprintf(stderr, "font format %d is not supported\n", format);
+    exit(1);
+  }
+  memcpy(header, font, HEADER_SIZE);
+  for ( e = start; e <= end; e++ ) {
+    if (p[0] == 255) {
+      p++;
+      continue;
+    }
+    if (format == 0) {
+      w = p[0];
+      h = p[1];
+      size = p[2];
+      dx = (int8_t)p[3];
+      x = (int8_t)p[4];
+      y = (int8_t)p[5];
+      data = p + 6;
+    }
+    else {
+      x = p[0] >> 4;
+      y = (p[0] & 15) - 2;
+      w = p[1] >> 4;
+      h = p[1] & 15;
+      dx = p[2] >> 4;
+      size = p[2] & 15;
+      data = p + 3;
+    }
+    if (e >= lo && e <= hi) {
+      struct glyph *g = new_glyph(e);
+      g->w = w;
+      g->h = h;
+      g->dx = dx;
+      g->x = x;
+      g->y = y;
+      g->size = (w + 7) / 8 * h;
+      memcpy(g->data, data, g->size);
+    }
+    p = data + size;
+  }
+}
+
+static int hex_digit(int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// read STARTCHAR ... ENDCHAR blocks, all other lines are ignored
+static void read_bdf(const char *name) {
+  FILE *fp = fopen(name, "r");
+  char line[1024];
+  int encoding = -1, dx = 0, w = 0, h = 0, x = 0, y = 0;
+  int row, bpl, i, n = 0, skipped = 0;
+  struct glyph *g;
+
+  if (fp == NULL) {
+    perror(name);
+    exit(1);
+  }
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (strncmp(line, "STARTCHAR", 9) == 0) {
+      encoding = -1;
+      dx = w = h = x = y = 0;
+    }
+    else if (strncmp(line, "ENCODING ", 9) == 0) {
+      encoding = atoi(line + 9);
+    }
+    else if (strncmp(line, "DWIDTH ", 7) == 0) {
+      dx = atoi(line + 7);
+    }
+    else if (strncmp(line, "BBX ", 4) == 0) {
+      if (sscanf(line + 4, "%d %d %d %d", &w, &h, &x, &y) != 4) {
+        fprintf(stderr, "%s: bad line: %s", name, line);
+        exit(1);
+      }
+    }
+    else if (strncmp(line, "BITMAP", 6) == 0) {
+      bpl = (w + 7) / 8;
+      if (encoding < 0 || encoding > 0xffff || bpl * h > 255 || w > 255 || h > 255) {
+        skipped++;
+        continue;
+      }
+      g = new_glyph(encoding);
+      g->w = w;
+      g->h = h;
+      g->dx = dx;
+      g->x = x;
+      g->y = y;
+      g->size = bpl * h;
+      for ( row = 0; row < h; row++ ) {
+        if (fgets(line, sizeof(line), fp) == NULL) {
+          fprintf(stderr, "%s: glyph %d: missing bitmap rows\n", name, encoding);
+          exit(1);
+        }
+        for ( i = 0; i < bpl; i++ ) {
+          if (hex_digit(line[2 * i]) < 0 || hex_digit(line[2 * i + 1]) < 0) {
+            fprintf(stderr, "%s: glyph %d: bad bitmap row: %s", name, encoding, line);
+            exit(1);
+          }
+          g->data[row * bpl + i] = hex_digit(line[2 * i]) << 4 | hex_digit(line[2 * i + 1]);
+        }
+      }
+      n++;
+    }
+  }
+  fclose(fp);
+  fprintf(stderr, "%s: %d glyphs", name, n);
+  if (skipped > 0)
+    fprintf(stderr, ", %d glyphs skipped (no 16 bit encoding or more than 255 bytes)", skipped);
+  fprintf(stderr, "\n");
+}
+
+// extend the font information of FONT by the added glyphs
+static void update_header(void) {
+  int e, bbx_x = (int8_t)header[3], bbx_y = (int8_t)header[4];
+  int bbx_r = bbx_x + header[1], bbx_t = bbx_y + header[2];
+  int ascent = (int8_t)header[13], descent = (int8_t)header[14];
+  const struct glyph *g;
+
+  for ( e = 0; e < 0x10000; e++ ) {
+    g = glyphs[e];
+    if (g == NULL || g->w == 0 || g->h == 0)
+      continue;
+    if (bbx_x > g->x) bbx_x = g->x;
+    if (bbx_y > g->y) bbx_y = g->y;
+    if (bbx_r < g->x + g->w) bbx_r = g->x + g->w;
+    if (bbx_t < g->y + g->h) bbx_t = g->y + g->h;
+    if (ascent < g->y + g->h) ascent = g->y + g->h;
+    if (descent > g->y) descent = g->y;
+  }
+  header[0] = 3;
+  header[1] = bbx_r - bbx_x;
+  header[2] = bbx_t - bbx_y;
+  header[3] = bbx_x;
+  header[4] = bbx_y;
+  header[13] = ascent;
+  header[14] = descent;
+}
+
+static void build_ranges(void) {
+  int e, last = -3;
+
+  range_cnt = 0;
+  for ( e = 0; e < 0x10000; e++ ) {
+    if (glyphs[e] == NULL)
+      continue;
+    if (e - last > 2) {
+      if (range_cnt == MAX_RANGES) {
+        fprintf(stderr, "more than %d ranges\n", MAX_RANGES);
+        exit(1);
+      }
+      range_first[range_cnt++] = e;
+    }
+    range_last[range_cnt - 1] = e;
+    last = e;
+  }
+}
+
+static void put_word(uint8_t *p, unsigned v) {
+  p[0] = v >> 8;
+  p[1] = v & 255;
+}
+
+static void write_font(void) {
+  long idx_pos, glyph_pos;
+  int r, e, idx_cnt = 0;
+  const struct glyph *g;
+
+  for ( r = 0; r < range_cnt; r++ )
+    idx_cnt += range_last[r] - range_first[r] + 1;
+  if (idx_cnt > 0xffff) {
+    fprintf(stderr, "more than 65535 index entries\n");
+    exit(1);
+  }
+  out = malloc(HEADER_SIZE + (long)range_cnt * RANGE_SIZE + 0x10000L * (INDEX_SIZE + 6 + 255));
+  if (out == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memcpy(out, header, HEADER_SIZE);
+  put_word(out + 6, range_cnt);
+  put_word(out + 8, idx_cnt);
+  out[10] = 0;
+  out[11] = 0;
+
+  idx_pos = HEADER_SIZE + (long)range_cnt * RANGE_SIZE;
+  glyph_pos = idx_pos + (long)idx_cnt * INDEX_SIZE;
+  idx_cnt = 0;
+  for ( r = 0; r < range_cnt; r++ ) {
+    put_word(out + HEADER_SIZE + r * RANGE_SIZE + 0, range_first[r]);
+    put_word(out + HEADER_SIZE + r * RANGE_SIZE + 2, range_last[r]);
+    put_word(out + HEADER_SIZE + r * RANGE_SIZE + 4, idx_cnt);
+    for ( e = range_first[r]; e <= range_last[r]; e++ ) {
+      uint8_t *idx = out + idx_pos + (long)idx_cnt * INDEX_SIZE;
+      idx_cnt++;
+      g = glyphs[e];
+      if (g == NULL) {
+        idx[0] = idx[1] = idx[2] = 0;
+        continue;
+      }
+      if (glyph_pos > 0xffffffL) {
+        fprintf(stderr, "font exceeds the 24 bit glyph offset\n");
+        exit(1);
+      }
+      idx[0] = glyph_pos >> 16;
+      idx[1] = (glyph_pos >> 8) & 255;
+      idx[2] = glyph_pos & 255;
+      out[glyph_pos + 0] = g->w;
+      out[glyph_pos + 1] = g->h;
+      out[glyph_pos + 2] = g->size;
+      out[glyph_pos + 3] = g->dx;
+      out[glyph_pos + 4] = g->x;
+      out[glyph_pos + 5] = g->y;
+      memcpy(out + glyph_pos + 6, g->data, g->size);
+      glyph_pos += 6 + g->size;
+    }
+  }
+  out_len = glyph_pos;
+}
+
+static unsigned get_word(const uint8_t *p) {
+  return p[0] << 8 | p[1];
+}
+
+// same algorithm as u8g_font_find_glyph16()
+static const uint8_t *find_glyph(int encoding) {
+  unsigned lo = 0, hi = get_word(out + 6), mid;
+  const uint8_t *range, *idx;
+  long offset;
+
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    range = out + HEADER_SIZE + mid * RANGE_SIZE;
+    if (encoding < (int)get_word(range))
+      hi = mid;
+    else if (encoding > (int)get_word(range + 2))
+      lo = mid + 1;
+    else {
+      idx = out + HEADER_SIZE + get_word(out + 6) * RANGE_SIZE;
+      idx += (get_word(range + 4) + encoding - get_word(range)) * INDEX_SIZE;
+      offset = (long)idx[0] << 16 | idx[1] << 8 | idx[2];
+      return offset == 0 ? NULL : out + offset;
+    }
+  }
+  return NULL;
+}
+
+static void check_font(void) {
+  const struct glyph *g;
+  const uint8_t *p;
+  int e;
+
+  for ( e = 0; e < 0x10000; e++ ) {
+    g = glyphs[e];
+    p = find_glyph(e);
+    if (g == NULL && p == NULL)
+      continue;
+    if (g == NULL || p == NULL || p[0] != g->w || p[1] != g->h || p[2] != g->size ||
+        (int8_t)p[3] != g->dx || (int8_t)p[4] != g->x || (int8_t)p[5] != g->y ||
+        memcmp(p + 6, g->data, g->size) != 0) {
+      fprintf(stderr, "glyph %d: lookup check failed\n", e);
+      exit(1);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *name = STR(FONT) "_utf8";
+  int lo = 0, hi = 255, i, e, cnt = 0;
+
+  for ( i = 1; i < argc && argv[i][0] == '-'; i++ ) {
+    if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      name = argv[++i];
+    }
+    else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc && sscanf(argv[i + 1], "%d-%d", &lo, &hi) == 2) {
+      i++;
+    }
+    else {
+      fprintf(stderr, "usage: %s [-n name] [-r lo-hi] [file.bdf ...]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  read_font(FONT, lo, hi);
+  for ( ; i < argc; i++ )
+    read_bdf(argv[i]);
+  update_header();
+  build_ranges();
+  write_font();
+  check_font();
+
+  for ( e = 0; e < 0x10000; e++ )
+    if (glyphs[e] != NULL)
+      cnt++;
+  fprintf(stderr, "%s: %d glyphs in %d ranges, %ld bytes\n", name, cnt, range_cnt, out_len);
+
+  printf("const u8g_fntpgm_uint8_t %s[%ld] U8G_FONT_SECTION(\"%s\") = {", name, out_len, name);
+  for ( i = 0; i < out_len; i++ ) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", out[i], i + 1 < out_len ? (i % 16 == 15 ? "," : ", ") : "");
+  }
+  printf("\n};\n");
+  return 0;
+}
@@ -0,0 +1,236 @@
+/*
+
+  u8g_font_rle.c
+
+  Host tool: convert a font of u8g_font_data.c (format 0 or 1) into the
+  run length encoded font format 4, see u8g_font.c
+
+  Build and run (from this directory):
+    gcc -I../src/clib -DFONT=u8g_font_10x20 u8g_font_rle.c ../src/clib/u8g_font_data.c -o u8g_font_rle
+    ./u8g_font_rle > u8g_font_10x20_rle.c
+
+  The bits per run are selected for the smallest font. Each glyph is decoded
+  again and compared with the original bitmap before the font is written.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "u8g.h"
+
+#ifndef FONT
+  #error "define FONT, e.g. -DFONT=u8g_font_10x20"
+#endif
+
+#define STR2(x) #x
+#define STR(x) STR2(x)
+
+#define HEADER_SIZE 17
+#define MAX_PIXEL (255 * 8)
+
+struct glyph {
+  int is_empty;
+  int w, h, dx, x, y;
+  uint8_t pixel[MAX_PIXEL];     // one byte per pixel, row by row
+};
+
+static struct glyph glyphs[256];
+static uint8_t out[65536];
+static int out_len;
+static int font_len;
+
+// bit writer, lsb first
+static uint8_t *bit_dest;
+static int bit_pos;
+
+static void put_bits(unsigned v, int n) {
+  int i;
+  for ( i = 0; i < n; i++ ) {
+    if ((bit_pos & 7) == 0)
+      bit_dest[bit_pos >> 3] = 0;
+    if (v & (1 << i))
+      bit_dest[bit_pos >> 3] |= 1 << (bit_pos & 7);
+    bit_pos++;
+  }
+}
+
+static void read_font(const uint8_t *font) {
+  int format = font[0];
+  int start = font[10], end = font[11];
+  const uint8_t *p = font + HEADER_SIZE;
+  int e, i, j, bpl, size;
+
+  if (format != 0 && format != 1) {
+    fprintf(stderr, "font format %d is not supported\n", format);
+    exit(1);
+  }
+  for ( e = start; e <= end; e++ ) {
+    struct glyph *g = glyphs + e;
+    const uint8_t *data;
+    if (p[0] == 255) {
+      g->is_empty = 1;
+      p++;
+      continue;
+    }
+    if (format == 0) {
+      g->w = p[0];
+      g->h = p[1];
+      size = p[2];
+      g->dx = (int8_t)p[3];
+      g->x = (int8_t)p[4];
+      g->y = (int8_t)p[5];
+      data = p + 6;
+    }
+    else {
+      g->x = p[0] >> 4;
+      g->y = (p[0] & 15) - 2;
+      g->w = p[1] >> 4;
+      g->h = p[1] & 15;
+      g->dx = p[2] >> 4;
+      size = p[2] & 15;
+      data = p + 3;
+    }
+    bpl = (g->w + 7) / 8;
+    for ( j = 0; j < g->h; j++ )
+      for ( i = 0; i < g->w; i++ )
+        g->pixel[j * g->w + i] = (data[j * bpl + i / 8] >> (7 - (i & 7))) & 1;
+    p = data + size;
+  }
+  font_len = p - font;
+}
+
+// encode one glyph, returns the number of bytes or a value above 255
+static int encode_glyph(const struct glyph *g, uint8_t *dest, int m0, int m1) {
+  int n = g->w * g->h, i = 0;
+  int max0 = (1 << m0) - 1, max1 = (1 << m1) - 1;
+  int pairs[2 * MAX_PIXEL][2], cnt = 0, k, a, b;
+
+  while (i < n) {
+    a = 0;
+    b = 0;
+    while (i < n && g->pixel[i] == 0) { a++; i++; }
+    while (i < n && g->pixel[i] != 0) { b++; i++; }
+    while (a > max0) { pairs[cnt][0] = max0; pairs[cnt][1] = 0; cnt++; a -= max0; }
+    while (b > max1) { pairs[cnt][0] = a; pairs[cnt][1] = max1; cnt++; a = 0; b -= max1; }
+    pairs[cnt][0] = a;
+    pairs[cnt][1] = b;
+    cnt++;
+  }
+
+  bit_dest = dest;
+  bit_pos = 0;
+  for ( k = 0; k < cnt; ) {
+    put_bits(pairs[k][0], m0);
+    put_bits(pairs[k][1], m1);
+    for ( i = k + 1; i < cnt && pairs[i][0] == pairs[k][0] && pairs[i][1] == pairs[k][1]; i++ )
+      put_bits(1, 1);
+    put_bits(0, 1);
+    k = i;
+  }
+  return (bit_pos + 7) / 8;
+}
+
+static int get_bits(const uint8_t *src, int n) {
+  int i, v = 0;
+  for ( i = 0; i < n; i++ ) {
+    v |= ((src[bit_pos >> 3] >> (bit_pos & 7)) & 1) << i;
+    bit_pos++;
+  }
+  return v;
+}
+
+// same algorithm as u8g_font_draw_rle(), without page clipping
+static int check_glyph(const struct glyph *g, const uint8_t *data, int m0, int m1) {
+  uint8_t pixel[MAX_PIXEL];
+  int pos = 0, n = g->w * g->h, a, b, i;
+
+  memset(pixel, 0, sizeof(pixel));
+  bit_pos = 0;
+  while (pos < n) {
+    a = get_bits(data, m0);
+    b = get_bits(data, m1);
+    do {
+      pos += a;
+      for ( i = 0; i < b && pos < n; i++ )
+        pixel[pos++] = 1;
+    } while (pos < n && get_bits(data, 1));
+  }
+  return memcmp(pixel, g->pixel, n) == 0;
+}
+
+static int write_font(const uint8_t *font, int m0, int m1, int is_check) {
+  int start = font[10], end = font[11], e, size;
+  uint16_t pos65 = 0, pos97 = 0;
+
+  memcpy(out, font, HEADER_SIZE);
+  out[0] = 4;
+  out[HEADER_SIZE] = (m0 << 4) | m1;
+  out_len = HEADER_SIZE + 1;
+  for ( e = start; e <= end; e++ ) {
+    const struct glyph *g = glyphs + e;
+    if (e == 65) pos65 = out_len;
+    if (e == 97) pos97 = out_len;
+    if (g->is_empty) {
+      out[out_len++] = 255;
+      continue;
+    }
+    size = encode_glyph(g, out + out_len + 6, m0, m1);
+    if (size > 255)
+      return -1;
+    if (is_check && !check_glyph(g, out + out_len + 6, m0, m1)) {
+      fprintf(stderr, "glyph %d: decode check failed\n", e);
+      exit(1);
+    }
+    out[out_len + 0] = g->w;
+    out[out_len + 1] = g->h;
+    out[out_len + 2] = size;
+    out[out_len + 3] = g->dx;
+    out[out_len + 4] = g->x;
+    out[out_len + 5] = g->y;
+    out_len += 6 + size;
+  }
+  // keep the shortcuts of the original font
+  if ((font[6] << 8 | font[7]) == 0) pos65 = 0;
+  if ((font[8] << 8 | font[9]) == 0) pos97 = 0;
+  out[6] = pos65 >> 8;
+  out[7] = pos65 & 255;
+  out[8] = pos97 >> 8;
+  out[9] = pos97 & 255;
+  return out_len;
+}
+
+int main(void) {
+  const uint8_t *font = FONT;
+  const char *name = STR(FONT);
+  int m0, m1, best = -1, best_m0 = 0, best_m1 = 0, len, i;
+
+  read_font(font);
+  for ( m0 = 1; m0 <= 7; m0++ ) {
+    for ( m1 = 1; m1 <= 7; m1++ ) {
+      len = write_font(font, m0, m1, 0);
+      if (len > 0 && (best < 0 || len < best)) {
+        best = len;
+        best_m0 = m0;
+        best_m1 = m1;
+      }
+    }
+  }
+  if (best < 0) {
+    fprintf(stderr, "%s: a compressed glyph exceeds 255 bytes\n", name);
+    return 1;
+  }
+  len = write_font(font, best_m0, best_m1, 1);
+  fprintf(stderr, "%s: %d bytes, format 4: %d bytes\n", name, font_len, len);
+  if (len >= font_len)
+    fprintf(stderr, "%s: format 4 is not smaller, keep the original font\n", name);
+
+  printf("const u8g_fntpgm_uint8_t %s_rle[%d] U8G_FONT_SECTION(\"%s_rle\") = {", name, len, name);
+  for ( i = 0; i < len; i++ ) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", out[i], i + 1 < len ? (i % 16 == 15 ? "," : ", ") : "");
+  }
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,215 @@
+/*
+
+  u8g_image_rle.c
+
+  Host tool: convert a PBM (P1 or P4) or XBM file into a compressed image,
+  see u8g_DrawImageP() and u8g_image.c
+
+  Build and run (from this directory):
+    gcc u8g_image_rle.c -o u8g_image_rle
+    ./u8g_image_rle logo.pbm logo > logo.c
+
+  Width and height are limited to 255, the range of u8g_uint_t. Option -16
+  allows up to 4096 for builds with U8G_16BIT:
+    ./u8g_image_rle -16 panel.pbm panel > panel.c
+
+  An optional third argument n puts a seek table entry on every 2^n th row
+  (default 3). Without a seek table entry close to the first row of a page,
+  u8g_DrawImageP() decodes the rows in front of the page again. n = 3 fits
+  page buffers of 8 rows, larger values save 2 bytes for each omitted entry.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_W 4096
+#define MAX_H 4096
+
+static unsigned char pixel[MAX_H][MAX_W / 8];   // msb is the left pixel
+static int width, height;
+static int max_size = 255;    // largest u8g_uint_t of the target, see option -16
+
+static unsigned char out[1 << 20];
+static int out_len;
+
+static void fail(const char *msg) {
+  fprintf(stderr, "%s\n", msg);
+  exit(1);
+}
+
+static void set_pixel(int x, int y) {
+  pixel[y][x / 8] |= 0x80 >> (x & 7);
+}
+
+static void check_size(void) {
+  if (width <= 0 || height <= 0 || width > MAX_W || height > MAX_H)
+    fail("unsupported image size");
+  if (width > max_size || height > max_size)
+    fail("image larger than 255 pixel: requires U8G_16BIT and option -16");
+}
+
+// skip white space and comments of a PBM file
+static void pbm_skip(FILE *fp) {
+  int c;
+  for ( ;; ) {
+    c = getc(fp);
+    if (c == '#') {
+      while (c != '\n' && c != EOF)
+        c = getc(fp);
+    }
+    else if (!isspace(c)) {
+      ungetc(c, fp);
+      return;
+    }
+  }
+}
+
+static void read_pbm(FILE *fp, int format) {
+  int x, y, c;
+  pbm_skip(fp);
+  if (fscanf(fp, "%d", &width) != 1)
+    fail("PBM: width is missing");
+  pbm_skip(fp);
+  if (fscanf(fp, "%d", &height) != 1)
+    fail("PBM: height is missing");
+  check_size();
+  if (format == 4) {
+    getc(fp);     // single white space after the header
+    for ( y = 0; y < height; y++ )
+      if (fread(pixel[y], 1, (width + 7) / 8, fp) != (size_t)((width + 7) / 8))
+        fail("PBM: file is too short");
+    // clear the padding bits
+    if (width & 7)
+      for ( y = 0; y < height; y++ )
+        pixel[y][width / 8] &= 0xff << (8 - (width & 7));
+    return;
+  }
+  for ( y = 0; y < height; y++ ) {
+    for ( x = 0; x < width; x++ ) {
+      pbm_skip(fp);
+      c = getc(fp);
+      if (c == '1')
+        set_pixel(x, y);
+      else if (c != '0')
+        fail("PBM: file is too short");
+    }
+  }
+}
+
+// XBM: "#define name_width w", "#define name_height h", hex bytes, lsb is the left pixel
+static void read_xbm(FILE *fp) {
+  char line[256], name[128];
+  int v, x, y, bpl;
+  unsigned int b;
+
+  rewind(fp);
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    if (sscanf(line, "#define %127s %d", name, &v) != 2)
+      continue;
+    if (strlen(name) > 6 && strcmp(name + strlen(name) - 6, "_width") == 0)
+      width = v;
+    if (strlen(name) > 7 && strcmp(name + strlen(name) - 7, "_height") == 0)
+      height = v;
+  }
+  check_size();
+  rewind(fp);
+  while ((v = getc(fp)) != EOF && v != '{')
+    ;
+  if (v == EOF)
+    fail("XBM: data is missing");
+  bpl = (width + 7) / 8;
+  for ( y = 0; y < height; y++ ) {
+    for ( x = 0; x < bpl; x++ ) {
+      if (fscanf(fp, " %x ,", &b) != 1)
+        fail("XBM: file is too short");
+      for ( v = 0; v < 8; v++ )
+        if ((b & (1 << v)) && x * 8 + v < width)
+          set_pixel(x * 8 + v, y);
+    }
+  }
+}
+
+// PackBits: runs of three or more equal bytes (or two at the start of a literal block) are repeated
+static void write_row(const unsigned char *row, int cnt) {
+  int i = 0, lit = -1, run;
+  while (i < cnt) {
+    run = 1;
+    while (i + run < cnt && run < 128 && row[i + run] == row[i])
+      run++;
+    if (run >= 3 || (run == 2 && lit < 0)) {
+      out[out_len++] = 257 - run;
+      out[out_len++] = row[i];
+      lit = -1;
+      i += run;
+      continue;
+    }
+    if (lit < 0 || out[lit] == 127) {
+      lit = out_len++;
+      out[lit] = 255;     // incremented to 0 below
+    }
+    out[lit]++;
+    out[out_len++] = row[i];
+    i++;
+  }
+}
+
+int main(int argc, char **argv) {
+  FILE *fp;
+  char magic[3] = { 0 };
+  int shift = 3, entries, y, i, table;
+
+  if (argc > 1 && strcmp(argv[1], "-16") == 0) {
+    max_size = MAX_W;
+    argv++;
+    argc--;
+  }
+  if (argc < 3) {
+    fprintf(stderr, "usage: %s [-16] file.pbm|file.xbm name [seek shift]\n", argv[0]);
+    return 1;
+  }
+  if (argc > 3)
+    shift = atoi(argv[3]);
+  if (shift < 0 || shift > 15)
+    fail("seek shift must be 0..15");
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL)
+    fail("can not open the input file");
+  if (fread(magic, 1, 2, fp) == 2 && magic[0] == 'P' && (magic[1] == '1' || magic[1] == '4'))
+    read_pbm(fp, magic[1] - '0');
+  else
+    read_xbm(fp);
+  fclose(fp);
+
+  entries = ((height - 1) >> shift) + 1;
+  out[0] = 0;
+  out[1] = width >> 8;
+  out[2] = width & 255;
+  out[3] = height >> 8;
+  out[4] = height & 255;
+  out[5] = shift;
+  table = 6;
+  out_len = table + entries * 2;
+  for ( y = 0; y < height; y++ ) {
+    if ((y & ((1 << shift) - 1)) == 0) {
+      int pos = out_len - (table + entries * 2);
+      if (pos > 65535)
+        fail("image data exceeds 64 KB, use a smaller image");
+      out[table + (y >> shift) * 2] = pos >> 8;
+      out[table + (y >> shift) * 2 + 1] = pos & 255;
+    }
+    write_row(pixel[y], (width + 7) / 8);
+  }
+  fprintf(stderr, "%s: %dx%d, raw %d bytes, compressed %d bytes\n", argv[2], width, height, (width + 7) / 8 * height, out_len);
+
+  printf("const u8g_pgm_uint8_t %s[%d] U8G_PROGMEM = {", argv[2], out_len);
+  for ( i = 0; i < out_len; i++ ) {
+    if (i % 16 == 0)
+      printf("\n  ");
+    printf("%d%s", out[i], i + 1 < out_len ? (i % 16 == 15 ? "," : ", ") : "");
+  }
+  printf("};\n");
+  return 0;
+}
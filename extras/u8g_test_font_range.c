@@ -0,0 +1,123 @@
+/*
+
+  u8g_test_font_range.c
+
+  Host test: draw UTF-8 strings with the format 3 font u8g_font_6x10_utf8
+  (ASCII, ISO 8859-1, Cyrillic and CJK in separate ranges), see u8g_font.c
+  and u8g_font_range.c
+
+  Build and run (from this directory):
+    gcc -I../src/clib u8g_test_font_range.c $(ls ../src/clib/u8g_*.c | grep -v -e _dev_ -e _com_) \
+      ../src/clib/u8g_com_api.c ../src/clib/u8g_com_null.c -o u8g_test_font_range
+    ./u8g_test_font_range
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "u8g.h"
+
+#define W 128
+#define H 64
+#define PAGE_HEIGHT 8
+
+static uint8_t pixel[H][W];
+
+/* copy each page into pixel[][] */
+static uint8_t capture_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  if ( msg == U8G_DEV_MSG_PAGE_NEXT )
+  {
+    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+    int x, y;
+    for( x = 0; x < W; x++ )
+      for( y = 0; y < PAGE_HEIGHT; y++ )
+        pixel[pb->p.page_y0 + y][x] = (((uint8_t *)(pb->buf))[x] >> y) & 1;
+  }
+  return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
+}
+
+U8G_PB_DEV(capture_dev, W, H, PAGE_HEIGHT, capture_fn, u8g_com_null_fn);
+
+void u8g_Delay(uint16_t val) { (void)val; }
+void u8g_MicroDelay(void) {}
+void u8g_10MicroDelay(void) {}
+
+static u8g_t u8g;
+static int failed;
+
+static void check(int is_ok, const char *what)
+{
+  printf("%s: %s\n", is_ok ? "ok" : "FAILED", what);
+  if ( is_ok == 0 )
+    failed++;
+}
+
+static void draw_str(const u8g_fntpgm_uint8_t *font, const char *s)
+{
+  memset(pixel, 0, sizeof(pixel));
+  u8g_FirstPage(&u8g);
+  do
+  {
+    u8g_SetFont(&u8g, font);
+    u8g_DrawStr(&u8g, 0, 20, s);
+  } while( u8g_NextPage(&u8g) );
+}
+
+/* compare the glyph at x (baseline 20) with the rows of extras/u8g_font_sample.bdf, 16 bit msb first */
+static int is_glyph(int x, int w, int h, int y_offset, const uint16_t *rows)
+{
+  int i, j, top = 20 - y_offset - h;
+  for( j = 0; j < h; j++ )
+    for( i = 0; i < w; i++ )
+      if ( pixel[top + j][x + i] != ((rows[j] >> (15 - i)) & 1) )
+        return 0;
+  return 1;
+}
+
+static const uint16_t glyph_pe[7] = { 0xf800, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800, 0x8800 };
+static const uint16_t glyph_er[7] = { 0xf000, 0x8800, 0x8800, 0x8800, 0xf000, 0x8000, 0x8000 };
+static const uint16_t glyph_zhong[10] = { 0x0800, 0x0800, 0xff80, 0x8880, 0x8880, 0x8880, 0xff80, 0x0800, 0x0800, 0x0800 };
+static const uint16_t glyph_wen[10] = { 0x0800, 0x0800, 0xff80, 0x2200, 0x2200, 0x1400, 0x0800, 0x1400, 0x6300, 0x8080 };
+
+int main(void)
+{
+  static uint8_t expected[H][W];
+
+  u8g_Init(&u8g, &capture_dev);
+
+  /* ASCII and ISO 8859-1: same pixel as the 8 bit font */
+  draw_str(u8g_font_6x10, "Gr\xfc\xdf" "e 123");
+  memcpy(expected, pixel, sizeof(pixel));
+  draw_str(u8g_font_6x10_utf8, "Gr\xc3\xbc\xc3\x9f" "e 123");
+  check(memcmp(expected, pixel, sizeof(pixel)) == 0, "ISO 8859-1 as UTF-8");
+
+  /* Cyrillic: first and last glyph of "Привет", one range per glyph */
+  draw_str(u8g_font_6x10_utf8, "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82");
+  check(is_glyph(0, 5, 7, 0, glyph_pe) && is_glyph(6, 5, 7, -2, glyph_er), "Cyrillic glyphs");
+  u8g_SetFont(&u8g, u8g_font_6x10_utf8);
+  check(u8g_GetStrWidth(&u8g, "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82") == 36, "Cyrillic width");
+
+  /* CJK after ASCII: "A中文" */
+  draw_str(u8g_font_6x10_utf8, "A\xe4\xb8\xad\xe6\x96\x87");
+  check(is_glyph(6, 9, 10, -2, glyph_zhong) && is_glyph(16, 9, 10, -2, glyph_wen), "CJK glyphs");
+  u8g_SetFont(&u8g, u8g_font_6x10_utf8);
+  check(u8g_GetStrWidth(&u8g, "A\xe4\xb8\xad\xe6\x96\x87") == 26, "CJK width");
+
+  /* a glyph which is not in the font (Ж) is not drawn */
+  check(u8g_GetStrWidth(&u8g, "A\xd0\x96Z") == 12, "missing glyph");
+
+  /* invalid UTF-8 is drawn as U+FFFD and does not end the string */
+  draw_str(u8g_font_6x10_utf8, "A\xef\xbf\xbdZ");
+  memcpy(expected, pixel, sizeof(pixel));
+  draw_str(u8g_font_6x10_utf8, "A\xc0\x80Z");
+  check(memcmp(expected, pixel, sizeof(pixel)) == 0, "overlong C0 80");
+  draw_str(u8g_font_6x10_utf8, "A\xed\xa0\x80Z");
+  check(memcmp(expected, pixel, sizeof(pixel)) == 0, "surrogate ED A0 80");
+  draw_str(u8g_font_6x10_utf8, "A\x80Z");
+  check(memcmp(expected, pixel, sizeof(pixel)) == 0, "continuation byte 80");
+  check(u8g_GetStrWidth(&u8g, "A\xe0\x80\x80Z") == 18, "overlong E0 80 80 width");
+
+  printf("%s\n", failed ? "FAILED" : "ok");
+  return failed ? 1 : 0;
+}
@@ -0,0 +1,147 @@
+/*
+
+  u8g_test_vs.c
+
+  Host test: virtual screen with two tiles on the same u8g_dev_t (the same
+  page buffer) and one tile on its own device, see u8g_virtual_screen.c
+
+  Build and run (from this directory):
+    gcc -I../src/clib u8g_test_vs.c $(ls ../src/clib/u8g_*.c | grep -v -e _dev_ -e _com_ -e font_data) \
+      ../src/clib/u8g_com_api.c ../src/clib/u8g_com_null.c -o u8g_test_vs
+    ./u8g_test_vs
+
+  The shared tiles are placed first and last and next to each other, each
+  with the synchronous and the asynchronous flush. Every tile must receive
+  all of its pages and show the same pixel as a single 192x32 page buffer.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "u8g.h"
+
+#define W 64
+#define H 32
+#define PAGE_HEIGHT 8
+
+static u8g_t child[3];
+static uint8_t tile_pixel[3][H][W];
+static int tile_pages[3];
+
+/* copy each page which is sent to a tile device */
+static uint8_t capture_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg)
+{
+  if ( msg == U8G_DEV_MSG_PAGE_NEXT )
+  {
+    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+    int n = (int)(u8g - child);
+    int x, y;
+    tile_pages[n]++;
+    for( x = 0; x < W; x++ )
+      for( y = 0; y < PAGE_HEIGHT; y++ )
+        tile_pixel[n][pb->p.page_y0 + y][x] = (((uint8_t *)(pb->buf))[x] >> y) & 1;
+  }
+  return u8g_dev_pb8v1_base_fn(u8g, dev, msg, arg);
+}
+
+U8G_PB_DEV(shared_dev, W, H, PAGE_HEIGHT, capture_fn, u8g_com_null_fn);
+U8G_PB_DEV(own_dev, W, H, PAGE_HEIGHT, capture_fn, u8g_com_null_fn);
+U8G_PB_DEV(ref_dev, 3*W, H, PAGE_HEIGHT, u8g_dev_pb8v1_base_fn, u8g_com_null_fn);
+
+static uint8_t ref_pixel[H][3*W];
+
+void u8g_Delay(uint16_t val) { (void)val; }
+void u8g_MicroDelay(void) {}
+void u8g_10MicroDelay(void) {}
+
+static void flush_start(u8g_vs_t *vs, u8g_vs_tile_t *tile)
+{
+  (void)vs;
+  u8g_vs_FlushTile(tile);
+}
+
+static void flush_wait(u8g_vs_t *vs, u8g_vs_tile_t *tile)
+{
+  (void)vs;
+  (void)tile;
+}
+
+static void draw(u8g_t *u8g)
+{
+  u8g_DrawLine(u8g, 0, 0, 3*W-1, H-1);
+  u8g_DrawFrame(u8g, 0, 0, 3*W, H);
+}
+
+static void draw_reference(void)
+{
+  u8g_t u8g;
+  u8g_pb_t *pb = (u8g_pb_t *)(ref_dev.dev_mem);
+  int x, y;
+  u8g_Init(&u8g, &ref_dev);
+  u8g_FirstPage(&u8g);
+  do
+  {
+    draw(&u8g);
+    for( x = 0; x < 3*W; x++ )
+      for( y = 0; y < PAGE_HEIGHT; y++ )
+        ref_pixel[pb->p.page_y0 + y][x] = (((uint8_t *)(pb->buf))[x] >> y) & 1;
+  } while( u8g_NextPage(&u8g) );
+}
+
+/* mode bit 0: asynchronous flush, mode bit 1: shared tiles next to each other */
+static int test(int mode)
+{
+  u8g_t u8g;
+  u8g_dev_t vs_dev;
+  u8g_vs_t vs;
+  u8g_vs_tile_t tile[3];
+  int pos[3] = { 0, 1, 2 };
+  int i, x, y, diff = 0;
+
+  if ( mode & 2 )
+  {
+    pos[1] = 2;
+    pos[2] = 1;
+  }
+  u8g_Init(&child[0], &shared_dev);
+  u8g_Init(&child[1], &own_dev);
+  u8g_Init(&child[2], &shared_dev);
+  u8g_InitVirtualScreenDev(&vs_dev, &vs);
+  u8g_Init(&u8g, &vs_dev);
+  u8g_SetVirtualScreenDimension(&u8g, 3*W, H);
+  for( i = 0; i < 3; i++ )
+    u8g_AddTileToVirtualScreen(&u8g, &tile[i], pos[i]*W, 0, &child[i], i == 1);
+  if ( mode & 1 )
+    u8g_SetVirtualScreenFlush(&u8g, flush_start, flush_wait, NULL);
+  u8g_UpdateDimension(&u8g);
+
+  memset(tile_pixel, 0, sizeof(tile_pixel));
+  memset(tile_pages, 0, sizeof(tile_pages));
+  u8g_FirstPage(&u8g);
+  do
+  {
+    draw(&u8g);
+  } while( u8g_NextPage(&u8g) );
+
+  for( i = 0; i < 3; i++ )
+    for( y = 0; y < H; y++ )
+      for( x = 0; x < W; x++ )
+        if ( tile_pixel[i][y][x] != ref_pixel[y][pos[i]*W + x] )
+          diff++;
+  printf("mode %d: pages %d %d %d, %d different pixel\n", mode, tile_pages[0], tile_pages[1], tile_pages[2], diff);
+  for( i = 0; i < 3; i++ )
+    if ( tile_pages[i] != H/PAGE_HEIGHT )
+      diff++;
+  return diff == 0;
+}
+
+int main(void)
+{
+  int mode, failed = 0;
+  draw_reference();
+  for( mode = 0; mode < 4; mode++ )
+    if ( test(mode) == 0 )
+      failed++;
+  printf("%s\n", failed ? "FAILED" : "ok");
+  return failed ? 1 : 0;
+}
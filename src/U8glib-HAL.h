@@ -110,15 +110,27 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
      /* screen scaling */
     void undoScale() { u8g_UndoScale(&u8g); }
     void setScale2x2() { u8g_SetScale2x2(&u8g); }
+    void setScale(uint8_t sx, uint8_t sy) { u8g_SetScale(&u8g, sx, sy); }
+
+     /* combined transformation */
+    void setRotation(uint8_t rot) { u8g_SetRotation(&u8g, rot); }
+    void setFlip(uint8_t flip) { u8g_SetFlip(&u8g, flip); }
+    void setTranslation(u8g_uint_t dx, u8g_uint_t dy) { u8g_SetTranslation(&u8g, dx, dy); }
+    void undoTransform() { u8g_UndoTransform(&u8g); }
 
      /* picture loop */
     void firstPage() { cbegin(); u8g_FirstPage(&u8g); }
+    void firstPageInBox(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) { cbegin(); u8g_FirstPageInBox(&u8g, x, y, w, h); }
+    void setFrameBox(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) { u8g_SetFrameBox(&u8g, x, y, w, h); }
     uint8_t nextPage() { return u8g_NextPage(&u8g); }
+    uint8_t drawWidgets(u8g_widget_t *root) { cbegin(); return u8g_DrawWidgets(&u8g, root); }
 
     /* system commands */
     uint8_t setContrast(uint8_t contrast) { cbegin(); return u8g_SetContrast(&u8g, contrast); }
     void sleepOn() { u8g_SleepOn(&u8g); }
     void sleepOff() { u8g_SleepOff(&u8g); }
+    uint8_t setStartLine(u8g_uint_t line) { return u8g_SetStartLine(&u8g, line); }
+    uint8_t scrollVertical(u8g_int_t n) { return u8g_ScrollVertical(&u8g, n); }
 
     /* graphic primitives */
     void setColorEntry(uint8_t color_index, uint8_t r, uint8_t g, uint8_t b) { u8g_SetColorEntry(&u8g, color_index, r, g, b); }
@@ -129,6 +141,9 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
     void setColorIndex(uint8_t color_index) { u8g_SetColorIndex(&u8g, color_index); }
     uint8_t getColorIndex() { return u8g_GetColorIndex(&u8g); }
 
+    void setOpaqueFrame() { u8g_SetOpaqueFrame(&u8g); }
+    void setClearValue(uint32_t value) { u8g_SetClearValue(&u8g, value); }
+
     void setDefaultForegroundColor() { u8g_SetDefaultForegroundColor(&u8g);  }
     void setDefaultBackgroundColor() { u8g_SetDefaultBackgroundColor(&u8g);  }
     void setDefaultMidColor() { u8g_SetDefaultMidColor(&u8g);  }
@@ -141,6 +156,7 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
     void drawHLine(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w) { u8g_DrawHLine(&u8g, x, y, w); }
     void drawVLine(u8g_uint_t x, u8g_uint_t y, u8g_uint_t h) { u8g_DrawVLine(&u8g, x, y, h); }
     void drawLine(u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2) { u8g_DrawLine(&u8g, x1, y1, x2, y2); }
+    void drawAALine(u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2) { u8g_DrawAALine(&u8g, x1, y1, x2, y2); }
 
     void drawFrame(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) { u8g_DrawFrame(&u8g, x, y, w, h); }
     void drawRFrame(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, u8g_uint_t r) { u8g_DrawRFrame(&u8g, x, y, w, h,r); }
@@ -155,6 +171,7 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
 
     void drawTriangle(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
       { u8g_DrawTriangle(&u8g, x0, y0, x1, y1, x2, y2); }
+    void fillPolygon(u8g_poly_t *poly) { u8g_FillPolygon(&u8g, poly); }
 
     /* bitmap handling */
     void drawBitmap(u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap)
@@ -166,14 +183,23 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
       { u8g_DrawXBM(&u8g, x, y, w, h, bitmap); }
     void drawXBMP(u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap)
       { u8g_DrawXBMP(&u8g, x, y, w, h, bitmap); }
+    void drawImageP(u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *image)
+      { u8g_DrawImageP(&u8g, x, y, image); }
+    void drawSprite(const u8g_sprite_t *sprite)
+      { u8g_DrawSprite(&u8g, sprite); }
+    void drawDither(u8g_dither_t *dither, u8g_uint_t x, u8g_uint_t y)
+      { u8g_DrawDither(&u8g, dither, x, y); }
 
     /* font handling */
     void setFont(const u8g_fntpgm_uint8_t *font) {u8g_SetFont(&u8g, font); }
     int8_t getFontAscent() { return u8g_GetFontAscent(&u8g); }
     int8_t getFontDescent() { return u8g_GetFontDescent(&u8g); }
     int8_t getFontLineSpacing() { return u8g_GetFontLineSpacing(&u8g); }
+    void setStrCache(void *mem, uint16_t size) { u8g_SetStrCache(&u8g, mem, size); }
+    void clearStrCache() { u8g_ClearStrCache(&u8g); }
 
     u8g_uint_t drawStr(u8g_uint_t x, u8g_uint_t y, const char *s) { return u8g_DrawStr(&u8g, x, y, s); }
+    u8g_uint_t drawAAStr(u8g_uint_t x, u8g_uint_t y, const char *s) { return u8g_DrawAAStr(&u8g, x, y, s); }
     u8g_uint_t drawStr90(u8g_uint_t x, u8g_uint_t y, const char *s) { return u8g_DrawStr90(&u8g, x, y, s); }
     u8g_uint_t drawStr180(u8g_uint_t x, u8g_uint_t y, const char *s) { return u8g_DrawStr180(&u8g, x, y, s); }
     u8g_uint_t drawStr270(u8g_uint_t x, u8g_uint_t y, const char *s) { return u8g_DrawStr270(&u8g, x, y, s); }
@@ -225,6 +251,14 @@ class U8GLIB : public U8GLIB_PRINT_CLASS {
 
     void setVirtualScreenDimension(u8g_uint_t width, u8g_uint_t height) { u8g_SetVirtualScreenDimension(&u8g, width, height); }
     uint8_t addToVirtualScreen(u8g_uint_t x, u8g_uint_t y, U8GLIB &child_u8g) { return u8g_AddToVirtualScreen(&u8g, x, y, &child_u8g.u8g); }
+    uint8_t addTileToVirtualScreen(u8g_vs_tile_t &tile, u8g_uint_t x, u8g_uint_t y, U8GLIB &child_u8g, uint8_t bus = 0)
+      { return u8g_AddTileToVirtualScreen(&u8g, &tile, x, y, &child_u8g.u8g, bus); }
+    void setVirtualScreenFlush(u8g_vs_flush_fn flush_start, u8g_vs_flush_fn flush_wait, void *user_ptr = NULL)
+      { u8g_SetVirtualScreenFlush(&u8g, flush_start, flush_wait, user_ptr); }
+
+    /* mirror device */
+    uint8_t addToMirror(u8g_mirror_child_t &node, U8GLIB &child_u8g, uint8_t layout)
+      { return u8g_AddToMirror(&u8g, &node, &child_u8g.u8g, layout); }
 
 };
 
@@ -858,6 +892,23 @@ public:
   void init(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1322_nhd31oled_2x_gr_hw_spi, cs, a0, reset); }
 };
 
+class U8GLIB_NHD31OLED_16GR : public U8GLIB {
+public:
+  U8GLIB_NHD31OLED_16GR() : U8GLIB() { }
+  U8GLIB_NHD31OLED_16GR(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { init(sck, mosi, cs, a0, reset); }
+  U8GLIB_NHD31OLED_16GR(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { init(cs, a0, reset); }
+  U8GLIB_NHD31OLED_16GR(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+                        uint8_t cs, uint8_t di, uint8_t rw = U8G_PIN_NONE, uint8_t reset = U8G_PIN_NONE) {
+    init(d0, d1, d2, d3, d4, d5, d6, d7, cs, di, rw, reset);
+  }
+  void init(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1322_nhd31oled_16gr_sw_spi, sck, mosi, cs, a0, reset); }
+  void init(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1322_nhd31oled_16gr_hw_spi, cs, a0, reset); }
+  void init(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7,
+            uint8_t cs, uint8_t di, uint8_t rw = U8G_PIN_NONE, uint8_t reset = U8G_PIN_NONE) {
+    U8GLIB::init(&u8g_dev_ssd1322_nhd31oled_16gr_parallel, d0, d1, d2, d3, d4, d5, d6, d7, U8G_PIN_NONE, cs, U8G_PIN_NONE, di, rw, reset);
+  }
+};
+
 class U8GLIB_SSD1306_128X64 : public U8GLIB {
 public:
   U8GLIB_SSD1306_128X64() : U8GLIB() { }
@@ -997,6 +1048,15 @@ public:
   void init(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1325_nhd27oled_2x_gr_hw_spi, cs, a0, reset); }
 };
 
+class U8GLIB_NHD27OLED_16GR : public U8GLIB {
+public:
+  U8GLIB_NHD27OLED_16GR() : U8GLIB() { }
+  U8GLIB_NHD27OLED_16GR(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { init(sck, mosi, cs, a0, reset); }
+  U8GLIB_NHD27OLED_16GR(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { init(cs, a0, reset); }
+  void init(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1325_nhd27oled_16gr_sw_spi, sck, mosi, cs, a0, reset); }
+  void init(uint8_t cs, uint8_t a0, uint8_t reset = U8G_PIN_NONE) { U8GLIB::init(&u8g_dev_ssd1325_nhd27oled_16gr_hw_spi, cs, a0, reset); }
+};
+
 class U8GLIB_SSD1327_96X96_GR : public U8GLIB {
 public:
   U8GLIB_SSD1327_96X96_GR() : U8GLIB() { }
@@ -1279,7 +1339,17 @@ public:
 };
 
 class U8GLIB_VS : public U8GLIB {
+  u8g_vs_t vs;
+  u8g_dev_t dev;
 public:
   U8GLIB_VS() { }
-  void init() { U8GLIB::init(&u8g_dev_vs); }
+  void init() { u8g_InitVirtualScreenDev(&dev, &vs); U8GLIB::init(&dev); }
+};
+
+class U8GLIB_MIRROR : public U8GLIB {
+  u8g_mirror_t mirror;
+  u8g_dev_t dev;
+public:
+  U8GLIB_MIRROR() { }
+  void init() { u8g_InitMirrorDev(&dev, &mirror); U8GLIB::init(&dev); }
 };
@@ -0,0 +1,142 @@
+/*
+
+  U8glibTemplate.h
+
+  Optional C++ template layer: compile time specialized page buffer access
+
+  U8GLIB_T<Dev, Layout, Width, Height, PageHeight> wraps one of the u8g_dev_xxx
+  devices. SET_PIXEL is handled by inline code with constant geometry, so the
+  compiler can specialize the pixel setter for the single display of a build.
+  SET_8PIXEL, spans and blocks use the fast paths of the page buffer
+  (U8G_DEV_MSG_GET_PB_FNS). All other messages (init, page handling, clear,
+  transfer) go to the device procedure of the original device, called with the
+  wrapper device, so a com procedure of U8GLIB(dev, com_fn) is used. The
+  drawing API is the one of U8GLIB.
+
+  Supported page buffers:
+    U8G_T_V1    pb8v1, pb16v1: vertical bytes, lsb is the upper pixel, planes of 8 rows
+    U8G_T_H1    pb8h1, pb16h1, pb32h1: horizontal bytes, msb is the left pixel
+
+  Example:
+    U8GLIB_T<&u8g_dev_ssd1306_128x64_hw_spi, U8G_T_V1, 128, 64, 8> u8g(cs, a0, reset);
+
+  The constructors and initT() take the arguments of U8GLIB(dev, ...) without
+  the device. An empty constructor leaves the display uninitialized, call
+  initT(...) later.
+  If the geometry does not match the page buffer of the device, the original
+  device is used without specialization.
+
+*/
+#pragma once
+
+#include "U8glib-HAL.h"
+
+#define U8G_T_V1 0
+#define U8G_T_H1 1
+
+template <uint8_t Layout, u8g_uint_t Width, u8g_uint_t Height, uint8_t PageHeight>
+struct U8G_PB_T {
+  static_assert(Layout == U8G_T_V1 || Layout == U8G_T_H1, "unsupported page buffer layout");
+  static_assert(Layout != U8G_T_V1 || (PageHeight & 7) == 0, "vertical page buffer: page height must be a multiple of 8");
+  static_assert(Layout != U8G_T_H1 || (Width & 7) == 0, "horizontal page buffer: width must be a multiple of 8");
+
+  static bool matches(const u8g_pb_t *pb) {
+    return pb->width == Width && pb->p.total_height == Height && pb->p.page_height == PageHeight;
+  }
+
+  static inline void set_pixel(u8g_pb_t *pb, u8g_uint_t x, u8g_uint_t y, uint8_t color) {
+    uint8_t *ptr = (uint8_t *)pb->buf;
+    uint8_t mask;
+    u8g_uint_t row;
+
+    if (y < pb->p.page_y0 || y > pb->p.page_y1 || x >= Width)
+      return;
+    row = y - pb->p.page_y0;
+
+    if (Layout == U8G_T_V1) {
+      if (PageHeight > 8)
+        ptr += (uint16_t)(row >> 3) * Width;
+      ptr += x;
+      mask = 1 << (row & 7);
+    }
+    else {
+      ptr += (uint16_t)row * (Width / 8) + (x >> 3);
+      mask = 0x80 >> (x & 7);
+    }
+
+    if (color)
+      *ptr |= mask;
+    else
+      *ptr &= ~mask;
+  }
+};
+
+template <u8g_dev_t *Dev, uint8_t Layout, u8g_uint_t Width, u8g_uint_t Height, uint8_t PageHeight>
+class U8GLIB_T : public U8GLIB {
+  private:
+    typedef U8G_PB_T<Layout, Width, Height, PageHeight> pb_t;
+    static u8g_dev_t tdev;
+    static u8g_pb_fns_t tfns;
+
+    static void fns_set_pixel(u8g_pb_t *pb, const u8g_dev_arg_pixel_t * const arg) {
+      pb_t::set_pixel(pb, arg->x, arg->y, arg->color);
+    }
+
+    static uint8_t dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+      switch (msg) {
+        case U8G_DEV_MSG_SET_PIXEL:
+          pb_t::set_pixel(pb, ((u8g_dev_arg_pixel_t *)arg)->x, ((u8g_dev_arg_pixel_t *)arg)->y, ((u8g_dev_arg_pixel_t *)arg)->color);
+          return 1;
+        case U8G_DEV_MSG_GET_PB_FNS: {
+          // direct access: specialized pixel setter, 8 pixel, span and block from the original page buffer
+          u8g_dev_arg_pb_fns_t *a = (u8g_dev_arg_pb_fns_t *)arg;
+          Dev->dev_fn(u8g, dev, msg, arg);
+          if (a->fns != NULL) {
+            tfns = *(a->fns);
+            tfns.set_pixel = fns_set_pixel;
+            a->fns = &tfns;
+          }
+          return 1;
+        }
+      }
+      // the wrapper device: com_fn may differ from the original device, dev_mem is the same page buffer
+      return Dev->dev_fn(u8g, dev, msg, arg);
+    }
+
+    static u8g_dev_t *select() {
+      if (!pb_t::matches((u8g_pb_t *)(Dev->dev_mem)))
+        return Dev;
+      tdev.dev_fn = dev_fn;
+      tdev.dev_mem = Dev->dev_mem;    // the page buffer, e.g. for the mirror device
+      tdev.com_fn = Dev->com_fn;
+      return &tdev;
+    }
+
+  public:
+    U8GLIB_T() { }
+    U8GLIB_T(u8g_com_fnptr com_fn)                                                 { initT(com_fn); }
+    U8GLIB_T(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset)     { initT(sck, mosi, cs, a0, reset); }
+    U8GLIB_T(uint8_t cs, uint8_t a0, uint8_t reset)                                { initT(cs, a0, reset); }
+    U8GLIB_T(uint8_t options)                                                      { initT(options); }
+    U8GLIB_T(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7, uint8_t en, uint8_t cs1, uint8_t cs2, uint8_t di, uint8_t rw, uint8_t reset)
+      { initT(d0, d1, d2, d3, d4, d5, d6, d7, en, cs1, cs2, di, rw, reset); }
+    U8GLIB_T(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7, uint8_t cs, uint8_t a0, uint8_t wr, uint8_t rd, uint8_t reset)
+      { initT(d0, d1, d2, d3, d4, d5, d6, d7, cs, a0, wr, rd, reset); }
+
+    void initT()                                                                   { init(select()); }
+    void initT(u8g_com_fnptr com_fn)                                               { init(select(), com_fn); }
+    void initT(uint8_t sck, uint8_t mosi, uint8_t cs, uint8_t a0, uint8_t reset)   { init(select(), sck, mosi, cs, a0, reset); }
+    void initT(uint8_t cs, uint8_t a0, uint8_t reset)                              { init(select(), cs, a0, reset); }
+    void initT(uint8_t options)                                                    { init(select(), options); }
+    void initT(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7, uint8_t en, uint8_t cs1, uint8_t cs2, uint8_t di, uint8_t rw, uint8_t reset)
+      { init(select(), d0, d1, d2, d3, d4, d5, d6, d7, en, cs1, cs2, di, rw, reset); }
+    void initT(uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7, uint8_t cs, uint8_t a0, uint8_t wr, uint8_t rd, uint8_t reset)
+      { init(select(), d0, d1, d2, d3, d4, d5, d6, d7, cs, a0, wr, rd, reset); }
+};
+
+template <u8g_dev_t *Dev, uint8_t Layout, u8g_uint_t Width, u8g_uint_t Height, uint8_t PageHeight>
+u8g_dev_t U8GLIB_T<Dev, Layout, Width, Height, PageHeight>::tdev;
+
+template <u8g_dev_t *Dev, uint8_t Layout, u8g_uint_t Width, u8g_uint_t Height, uint8_t PageHeight>
+u8g_pb_fns_t U8GLIB_T<Dev, Layout, Width, Height, PageHeight>::tfns;
@@ -157,6 +157,8 @@ typedef struct _u8g_dev_arg_pixel_t u8g_dev_arg_pixel_t;
 typedef struct _u8g_dev_arg_bbx_t u8g_dev_arg_bbx_t;
 typedef struct _u8g_box_t u8g_box_t;
 typedef struct _u8g_dev_arg_irgb_t u8g_dev_arg_irgb_t;
+typedef struct _u8g_dev_arg_8x8_t u8g_dev_arg_8x8_t;
+typedef struct _u8g_dev_arg_start_line_t u8g_dev_arg_start_line_t;
 
 /*===============================================================*/
 /* generic */
@@ -396,6 +398,10 @@ extern u8g_dev_t u8g_dev_ssd1325_nhd27oled_2x_bw_parallel;
 extern u8g_dev_t u8g_dev_ssd1325_nhd27oled_2x_gr_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1325_nhd27oled_2x_gr_hw_spi;
 
+/* 16 gray levels, 4 bit per pixel page buffer */
+extern u8g_dev_t u8g_dev_ssd1325_nhd27oled_16gr_sw_spi;
+extern u8g_dev_t u8g_dev_ssd1325_nhd27oled_16gr_hw_spi;
+
 /* LY120 OLED with SSD1327 Controller (tested with Seeedstudio module) */
 extern u8g_dev_t u8g_dev_ssd1327_96x96_gr_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1327_96x96_gr_hw_spi;
@@ -418,6 +424,11 @@ extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_gr_parallel;
 extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_2x_gr_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_2x_gr_hw_spi;
 
+/* 16 gray levels, 4 bit per pixel page buffer */
+extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_16gr_sw_spi;
+extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_16gr_hw_spi;
+extern u8g_dev_t u8g_dev_ssd1322_nhd31oled_16gr_parallel;
+
 /* OLED 128x64 Display with SSD1306 Controller */
 extern u8g_dev_t u8g_dev_ssd1306_128x64_sw_spi;
 extern u8g_dev_t u8g_dev_ssd1306_128x64_hw_spi;
@@ -539,6 +550,16 @@ struct _u8g_dev_arg_pixel_t
 };
 /* typedef struct _u8g_dev_arg_pixel_t u8g_dev_arg_pixel_t; */ /* forward decl */
 
+/* block of up to 8 rows with 8 pixel, see U8G_DEV_MSG_SET_8X8PIXEL */
+struct _u8g_dev_arg_8x8_t
+{
+  u8g_uint_t x, y;    /* upper left pixel */
+  uint8_t rows[8];    /* msb is the left pixel, only set pixels are drawn */
+  uint8_t cnt;        /* number of rows, 0 checks for support only */
+  uint8_t color;
+  uint8_t is_done;    /* set to 1 by a device which supports this message */
+};
+
 /* range for r,g,b: 0..255 */
 #define U8G_GET_HICOLOR_BY_RGB(r,g,b) (((uint16_t)((r)&0x0f8))<<8)|(((uint16_t)((g)&0x0fc))<<3)|(((uint16_t)((b)>>3)))
 
@@ -560,6 +581,15 @@ struct _u8g_dev_arg_irgb_t
 };
 /* typedef struct _u8g_dev_arg_irgb_t u8g_dev_arg_irgb_t; */ /* forward decl */
 
+struct _u8g_dev_arg_start_line_t
+{
+  u8g_uint_t line;      /* display RAM row shown at the top, result for is_relative */
+  u8g_int_t n;          /* is_relative: scroll by n rows, positive moves the content up */
+  uint8_t is_relative;
+  uint8_t is_done;      /* set to 1 by a device which supports this message */
+};
+/* typedef struct _u8g_dev_arg_start_line_t u8g_dev_arg_start_line_t; */ /* forward decl */
+
 #define U8G_DEV_MSG_INIT                10
 #define U8G_DEV_MSG_STOP                  11
 
@@ -579,6 +609,15 @@ struct _u8g_dev_arg_irgb_t
 /* arg: u8g_box_t *, fill structure with current page properties */
 #define U8G_DEV_MSG_GET_PAGE_BOX 23
 
+/* arg: NULL, fill the page buffer with the clear value (deferred clear, see u8g_pb.c) */
+#define U8G_DEV_MSG_CLEAR_PAGE 24
+
+/* arg: u8g_dev_arg_start_line_t *, hardware scrolling, devices with a start line register set is_done */
+#define U8G_DEV_MSG_SET_START_LINE 25
+
+/* arg: u8g_box_t *, the next frame covers only the pages which intersect the box (see u8g_SetFrameBox) */
+#define U8G_DEV_MSG_SET_FRAME_BOX 26
+
 /*
 #define U8G_DEV_MSG_PRIMITIVE_START             30
 #define U8G_DEV_MSG_PRIMITIVE_END               31
@@ -588,6 +627,9 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_DEV_MSG_SET_TPIXEL        44
 #define U8G_DEV_MSG_SET_4TPIXEL     45
 
+/* arg: u8g_dev_arg_8x8_t *, optional, supported by the vertical page buffers */
+#define U8G_DEV_MSG_SET_8X8PIXEL    46
+
 #define U8G_DEV_MSG_SET_PIXEL                           50
 #define U8G_DEV_MSG_SET_8PIXEL                          59
 
@@ -599,6 +641,9 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_DEV_MSG_GET_HEIGHT                           71
 #define U8G_DEV_MSG_GET_MODE                  72
 
+/* arg: u8g_dev_arg_pb_fns_t *, page buffer base functions fill in their direct entry points */
+#define U8G_DEV_MSG_GET_PB_FNS                73
+
 /*===============================================================*/
 /* device modes */
 #define U8G_MODE(is_index_mode, is_color, bits_per_pixel) (((is_index_mode)<<6) | ((is_color)<<5)|(bits_per_pixel))
@@ -606,6 +651,7 @@ struct _u8g_dev_arg_irgb_t
 #define U8G_MODE_UNKNOWN     0
 #define U8G_MODE_BW     U8G_MODE(0, 0, 1)
 #define U8G_MODE_GRAY2BIT     U8G_MODE(0, 0, 2)
+#define U8G_MODE_GRAY4BIT     U8G_MODE(0, 0, 4)
 #define U8G_MODE_R3G3B2  U8G_MODE(0, 1, 8)
 #define U8G_MODE_INDEX  U8G_MODE(1, 1, 8)
 /* hicolor is R5G6B5 */
@@ -929,6 +975,13 @@ uint8_t u8g_WriteByteBWTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t b);
 uint8_t u8g_WriteSequenceBWTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t cnt, uint8_t *ptr);
 uint8_t u8g_WriteByte4LTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t b);
 uint8_t u8g_WriteSequence4LTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t cnt, uint8_t *ptr);
+void u8g_ConvertBWTo16Gr(uint8_t *dest, const uint8_t *src, uint8_t cnt);
+void u8g_Convert4LTo16Gr(uint8_t *dest, const uint8_t *src, uint8_t cnt);
+
+/* u8g_com_api_t6963.c */
+#define U8G_T6963_SHADOW_SIZE(width, height) (((height) + 7) / 8 + (width) / 8 * (height))   /* row valid bits and a copy of the display RAM */
+void u8g_InitT6963Shadow(uint8_t *shadow, u8g_uint_t height);
+void u8g_WriteT6963Page(u8g_t *u8g, u8g_dev_t *dev, uint8_t *shadow);
 
 /*===============================================================*/
 /* u8g_arduino_common.c */
@@ -960,13 +1013,20 @@ struct _u8g_page_t
   u8g_uint_t total_height;
   u8g_uint_t page_y0;
   u8g_uint_t page_y1;
-  uint8_t page;
+  uint8_t page;           /* page of the display RAM */
+  uint8_t start_page;     /* page of the display RAM shown at the top (hardware scrolling) */
+  uint8_t is_range;       /* 1: the next frame covers only range_y0..range_y1, 2: full frame after more than one scroll */
+  u8g_uint_t range_y0;
+  u8g_uint_t range_y1;
 };
 typedef struct _u8g_page_t u8g_page_t;
 
 void u8g_page_First(u8g_page_t *p);                                                                                        /* u8g_page.c */
 void u8g_page_Init(u8g_page_t *p, u8g_uint_t page_height, u8g_uint_t total_height );            /* u8g_page.c */
 uint8_t u8g_page_Next(u8g_page_t *p);                                                                                   /* u8g_page.c */
+void u8g_page_InitStartLine(u8g_page_t *p);                                                                        /* u8g_page.c */
+uint8_t u8g_page_SetStartLine(u8g_page_t *p, u8g_dev_arg_start_line_t *arg);                         /* u8g_page.c */
+void u8g_page_SetRange(u8g_page_t *p, u8g_uint_t y0, u8g_uint_t y1);                                 /* u8g_page.c */
 
 /*===============================================================*/
 /* page buffer (pb) */
@@ -979,8 +1039,34 @@ struct _u8g_pb_t
 };
 typedef struct _u8g_pb_t u8g_pb_t;
 
+/*
+  Direct entry points of a page buffer layout, used by u8g_DrawPixel(), u8g_Draw8Pixel(),
+  u8g_Draw8x8Pixel() and u8g_draw_hline() if the device is a page buffer without any
+  chained device in between (no transform, no virtual screen). NULL: not supported.
+*/
+struct _u8g_pb_fns_t
+{
+  void (*set_pixel)(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel);    /* clips */
+  void (*set_8pixel)(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel);                /* clips */
+  void (*set_span)(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color);  /* x..x+w-1 < width, y inside the page */
+  void (*set_8x8pixel)(u8g_pb_t *b, u8g_dev_arg_8x8_t *arg);                     /* clips */
+};
+typedef struct _u8g_pb_fns_t u8g_pb_fns_t;
+
+struct _u8g_dev_arg_pb_fns_t
+{
+  const u8g_pb_fns_t *fns;
+  u8g_pb_t *pb;
+};
+typedef struct _u8g_dev_arg_pb_fns_t u8g_dev_arg_pb_fns_t;
+
 /* u8g_pb.c */
 void u8g_pb_Clear(u8g_pb_t *b);
+void u8g_pb_Fill(u8g_pb_t *b, uint16_t size, uint8_t unit, uint32_t value);
+void u8g_pb_ClearPage(u8g_t *u8g, u8g_pb_t *b, uint16_t size, uint8_t unit);
+void u8g_pb_SetV8x8Pixel(u8g_pb_t *b, u8g_dev_arg_8x8_t *arg, uint8_t plane_rows, uint8_t bits_per_pixel);
+void u8g_pb_SetV1Span(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color, uint8_t plane_rows);
+void u8g_pb_Set4TPixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel, void (*set_tpixel)(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel));
 uint8_t u8g_pb_IsYIntersection(u8g_pb_t *pb, u8g_uint_t v0, u8g_uint_t v1);
 uint8_t u8g_pb_IsXIntersection(u8g_pb_t *b, u8g_uint_t v0, u8g_uint_t v1);
 uint8_t u8g_pb_IsIntersection(u8g_pb_t *pb, u8g_dev_arg_bbx_t *bbx);
@@ -1003,7 +1089,7 @@ uint8_t u8g_pb_WriteBuffer(u8g_pb_t *b, u8g_t *u8g, u8g_dev_t *dev);
 */
 #define U8G_PB_DEV(name, width, height, page_height, dev_fn, com_fn) \
 uint8_t name##_buf[width] U8G_NOCOMMON ; \
-u8g_pb_t name##_pb = { {page_height, height, 0, 0, 0},  width, name##_buf}; \
+u8g_pb_t name##_pb = { {page_height, height, 0, 0, 0, 0, 0, 0, 0},  width, name##_buf}; \
 u8g_dev_t name = { dev_fn, &name##_pb, com_fn }
 
 void u8g_pb8v1_Init(u8g_pb_t *b, void *buf, u8g_uint_t width);
@@ -1029,6 +1115,8 @@ uint8_t u8g_dev_pb16v2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
 
 /* u8g_pb8h1.c */
 uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+void u8g_pb8h1_Set8PixelH(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel, uint8_t is_lsb_left);  /* all horizontal 1 bit page buffers */
+void u8g_pb8h1_SetSpanH(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color, uint8_t is_lsb_left);
 
 /* u8g_pb16h1.c */
 uint8_t u8g_dev_pb16h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
@@ -1042,6 +1130,9 @@ uint8_t u8g_dev_pb8h2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
 /* u8g_pb16h2.c */
 uint8_t u8g_dev_pb16h2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
+/* u8g_pb8h4.c 2 pixel rows, 4 bit per pixel, byte has horizontal orientation */
+uint8_t u8g_dev_pb8h4_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+
 /* u8g_pb8h1f.c */
 uint8_t u8g_dev_pb8h1f_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
@@ -1128,6 +1219,9 @@ struct _u8g_t
   uint8_t cursor_fg_color, cursor_bg_color;
   uint8_t cursor_encoding;
   uint8_t mode;                         /* display mode, one of U8G_MODE_xxx */
+  uint8_t dev_caps;                     /* optional device messages, U8G_DEV_CAP_xxx */
+  const u8g_pb_fns_t *pb_fns;           /* direct page buffer access, see U8G_DEV_MSG_GET_PB_FNS */
+  u8g_pb_t *pb_direct;
   u8g_uint_t cursor_x;
   u8g_uint_t cursor_y;
   u8g_draw_cursor_fn cursor_fn;
@@ -1156,13 +1250,27 @@ struct _u8g_t
 
   u8g_box_t current_page;   /* current box of the visible page */
 
+  uint8_t pb_clear;           /* U8G_PB_CLEAR_xxx flags */
+  uint32_t pb_clear_value;    /* page buffer content of one pixel after clear, low byte first */
+
+  void *str_cache;            /* rasterized strings of u8g_DrawStr(), see u8g_SetStrCache() */
+  uint16_t str_cache_size;
 };
 
+/* u8g_t dev_caps flags, updated by u8g_UpdateDimension() */
+#define U8G_DEV_CAP_8X8PIXEL  1   /* device draws U8G_DEV_MSG_SET_8X8PIXEL blocks */
+
+/* u8g_t pb_clear flags */
+#define U8G_PB_CLEAR_DEFER    1   /* frame started by u8g_FirstPageLL: page buffers may defer their clear */
+#define U8G_PB_CLEAR_PENDING  2   /* page buffer clear is deferred to the first drawing */
+#define U8G_PB_CLEAR_OPAQUE   4   /* all pages of this frame are fully overwritten: do not clear */
+
 #define u8g_GetFontAscent(u8g) ((u8g)->font_ref_ascent)
 #define u8g_GetFontDescent(u8g) ((u8g)->font_ref_descent)
 #define u8g_GetFontLineSpacing(u8g) ((u8g)->line_spacing)
 
 uint8_t u8g_call_dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+u8g_pb_t *u8g_get_direct_pb(u8g_t *u8g);
 
 uint8_t u8g_InitLL(u8g_t *u8g, u8g_dev_t *dev);
 void u8g_FirstPageLL(u8g_t *u8g, u8g_dev_t *dev);
@@ -1192,18 +1300,26 @@ uint8_t u8g_InitRW8Bit(u8g_t *u8g, u8g_dev_t *dev, uint8_t d0, uint8_t d1, uint8
 #endif
 
 void u8g_FirstPage(u8g_t *u8g);
+void u8g_FirstPageInBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);  /* picture loop over the pages which intersect the box */
 uint8_t u8g_NextPage(u8g_t *u8g);
 uint8_t u8g_SetContrast(u8g_t *u8g, uint8_t contrast);
 void u8g_SleepOn(u8g_t *u8g);
 void u8g_SleepOff(u8g_t *u8g);
+uint8_t u8g_SetStartLine(u8g_t *u8g, u8g_uint_t line);     /* hardware scrolling, returns 0 if not supported */
+uint8_t u8g_ScrollVertical(u8g_t *u8g, u8g_int_t n);
+void u8g_SetFrameBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);      /* next frame: only pages which intersect the box */
 void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y);
 void u8g_Draw8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
 void u8g_Draw4TPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel);
+void u8g_DrawTPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t coverage);
 void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixel);
+void u8g_Draw8x8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t cnt, const uint8_t *rows);
 
 uint8_t u8g_Stop(u8g_t *u8g);
 void u8g_SetColorEntry(u8g_t *u8g, uint8_t idx, uint8_t r, uint8_t g, uint8_t b);
 void u8g_SetColorIndex(u8g_t *u8g, uint8_t idx);
+void u8g_SetOpaqueFrame(u8g_t *u8g);
+void u8g_SetClearValue(u8g_t *u8g, uint32_t value);
 void u8g_SetHiColor(u8g_t *u8g, uint16_t rgb);
 void u8g_SetHiColorByRGB(u8g_t *u8g, uint8_t r, uint8_t g, uint8_t b);
 void u8g_SetRGB(u8g_t *u8g, uint8_t r, uint8_t g, uint8_t b);
@@ -1251,6 +1367,7 @@ void u8g_SetHardwareBackup(u8g_t *u8g, u8g_state_cb backup_cb);
 /* u8g_clip.c */
 
 uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);
+uint8_t u8g_GetPageRows(u8g_t *u8g, u8g_uint_t y, u8g_uint_t h, u8g_uint_t *r_first, u8g_uint_t *r_last);    /* rows of y..y+h-1 inside the current page */
 
 /* u8g_rot.c */
 
@@ -1261,11 +1378,29 @@ void u8g_SetRot270(u8g_t *u8g);
 
 /* u8g_scale.c */
 
+/* largest integer factor for u8g_SetScale() */
+#define U8G_SCALE_MAX 4
+
 void u8g_UndoScale(u8g_t *u8g);
 void u8g_SetScale2x2(u8g_t *u8g);
 
+/* u8g_transform.c */
+
+#define U8G_FLIP_X 1
+#define U8G_FLIP_Y 2
+
+void u8g_SetRotation(u8g_t *u8g, uint8_t rot);
+void u8g_SetScale(u8g_t *u8g, uint8_t sx, uint8_t sy);
+void u8g_SetFlip(u8g_t *u8g, uint8_t flip);
+void u8g_SetTranslation(u8g_t *u8g, u8g_uint_t dx, u8g_uint_t dy);
+void u8g_UndoTransform(u8g_t *u8g);
+
 /* u8g_font.c */
 
+/* returned for invalid UTF-8 sequences and code points above 0xffff: the replacement char U+FFFD */
+/* of the font is drawn, nothing is drawn if the font does not have this glyph */
+#define U8G_ENCODING_INVALID 0x0fffd
+
 size_t u8g_font_GetSize(const void *font);
 uint8_t u8g_font_GetFontStartEncoding(const void *font);
 uint8_t u8g_font_GetFontEndEncoding(const void *font);
@@ -1279,12 +1414,20 @@ int8_t u8g_GetFontBBXOffY(u8g_t *u8g);
 uint8_t u8g_GetFontCapitalAHeight(u8g_t *u8g);
 
 uint8_t u8g_IsGlyph(u8g_t *u8g, uint8_t requested_encoding);
+uint8_t u8g_IsGlyph16(u8g_t *u8g, uint16_t requested_encoding);
 int8_t u8g_GetGlyphDeltaX(u8g_t *u8g, uint8_t requested_encoding);
 
 int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding); /* used by u8g_cursor.c */
+int8_t u8g_draw_glyph16(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding);
+
+typedef char (*u8g_font_get_char_fn)(const void *s);
+char u8g_font_get_char(const void *s);
+char u8g_font_get_charP(const void *s);
+uint16_t u8g_font_next_encoding(u8g_t *u8g, const char **s, u8g_font_get_char_fn get_char);   /* 0 at the end of the string */
 
 int8_t u8g_DrawGlyphDir(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t encoding);
 int8_t u8g_DrawGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding);
+int8_t u8g_DrawGlyph16(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding);   /* 16 bit encodings: font format 3 */
 int8_t u8g_DrawGlyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding);
 int8_t u8g_DrawGlyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding);
 int8_t u8g_DrawGlyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding);
@@ -1333,6 +1476,8 @@ u8g_uint_t u8g_DrawAAStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s);
 
 /* u8g_rect.c */
 
+void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w);    /* no intersection test */
+void u8g_draw_vline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t h);
 void u8g_draw_box(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);
 
 void u8g_DrawHLine(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w);
@@ -1349,12 +1494,99 @@ void u8g_DrawHBitmap(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, con
 void u8g_DrawHBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, const u8g_pgm_uint8_t *bitmap);
 void u8g_DrawBitmap(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap);
 void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap);
+void u8g_draw_bitmap_rows(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap, uint8_t is_pgm);
 
 void u8g_DrawXBM(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const uint8_t *bitmap);
 void u8g_DrawXBMP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap);
 
+/* u8g_image.c */
+
+uint16_t u8g_GetImageWidth(const u8g_pgm_uint8_t *image);
+uint16_t u8g_GetImageHeight(const u8g_pgm_uint8_t *image);
+void u8g_DrawImageP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *image);    /* image: output of extras/u8g_image_rle.c */
+
+/* u8g_sprite.c */
+
+typedef struct _u8g_sprite_t u8g_sprite_t;
+
+struct _u8g_sprite_t
+{
+  const u8g_pgm_uint8_t *image;   /* first row of the sprite inside the atlas */
+  const u8g_pgm_uint8_t *mask;    /* first row of the mask */
+  u8g_uint_t x, y;                /* upper left corner */
+  uint8_t cnt;                    /* bytes per row */
+  uint8_t h;                      /* number of rows */
+};
+
+uint8_t u8g_GetAtlasSpriteCnt(const u8g_pgm_uint8_t *atlas);
+void u8g_SetSprite(u8g_sprite_t *sprite, const u8g_pgm_uint8_t *atlas, uint8_t idx, u8g_uint_t x, u8g_uint_t y);
+void u8g_MoveSprite(u8g_sprite_t *sprite, u8g_uint_t x, u8g_uint_t y);
+void u8g_DrawSprite(u8g_t *u8g, const u8g_sprite_t *sprite);      /* mask pixel: image pixel set: current color, clear: background color */
+
+/* u8g_dither.c */
+
+#define U8G_DITHER_GRAY8 0
+#define U8G_DITHER_R3G3B2 1
+
+#define U8G_DITHER_BAYER 0
+#define U8G_DITHER_FLOYD_STEINBERG 1
+
+typedef struct _u8g_dither_t u8g_dither_t;
+
+/* returns the w pixel of row r, the pointer must be valid until the next call */
+typedef const uint8_t *(*u8g_dither_row_fn)(void *ctx, u8g_uint_t r);
+
+struct _u8g_dither_t
+{
+  u8g_dither_row_fn row_fn;
+  void *ctx;
+  int16_t *err;           /* w + 2 entries for U8G_DITHER_FLOYD_STEINBERG, otherwise NULL */
+  u8g_uint_t w, h;
+  uint8_t format;         /* U8G_DITHER_GRAY8 or U8G_DITHER_R3G3B2 */
+  uint8_t method;         /* U8G_DITHER_BAYER or U8G_DITHER_FLOYD_STEINBERG */
+  u8g_uint_t next_row;    /* first row without error in err */
+};
+
+void u8g_InitDither(u8g_dither_t *d, u8g_uint_t w, u8g_uint_t h, uint8_t format, uint8_t method, int16_t *err, u8g_dither_row_fn row_fn, void *ctx);
+void u8g_DrawDither(u8g_t *u8g, u8g_dither_t *d, u8g_uint_t x, u8g_uint_t y);
+
+/* u8g_widget.c */
+
+#define U8G_WIDGET_DIRTY 1
+#define U8G_WIDGET_HIDDEN 2
+
+typedef struct _u8g_widget_t u8g_widget_t;
+typedef void (*u8g_widget_draw_fn)(u8g_t *u8g, u8g_widget_t *widget);
+
+struct _u8g_widget_t
+{
+  u8g_widget_t *next;             /* next sibling */
+  u8g_widget_t *child;            /* first child */
+  u8g_widget_draw_fn draw_fn;     /* NULL for a group of widgets */
+  u8g_uint_t x, y, w, h;          /* box in display coordinates */
+  uint8_t flags;                  /* U8G_WIDGET_DIRTY, U8G_WIDGET_HIDDEN */
+  const void *data;               /* text, suffix, atlas or list items */
+  const u8g_fntpgm_uint8_t *font; /* NULL: current font */
+  int32_t value;                  /* value, sprite index or selected item */
+  int32_t max;                    /* bar: full value, list: number of items */
+};
+
+void u8g_InitWidget(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h);
+void u8g_InitLabel(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char *s);
+void u8g_InitValue(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char *suffix);
+void u8g_InitIcon(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *atlas, uint8_t idx);
+void u8g_InitBar(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, int32_t max);
+void u8g_InitList(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char * const *items, uint8_t cnt);
+void u8g_AddWidget(u8g_widget_t *parent, u8g_widget_t *child);
+void u8g_InvalidateWidget(u8g_widget_t *widget);
+void u8g_SetWidgetValue(u8g_widget_t *widget, int32_t value);
+void u8g_SetWidgetText(u8g_widget_t *widget, const char *s);
+void u8g_SetWidgetVisible(u8g_widget_t *widget, uint8_t is_visible);
+uint8_t u8g_DrawWidgets(u8g_t *u8g, u8g_widget_t *root);    /* draws only pages with dirty widgets, returns 0 if nothing was dirty */
+
 /* u8g_line.c */
 void u8g_DrawLine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2);
+void u8g_DrawAALine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2);
 
 /* u8g_circle.c */
 
@@ -1377,6 +1609,8 @@ void u8g_DrawEllipseRect(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t x1
 
 void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
 void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
+void u8g_draw_quadrant_span(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t dy, u8g_uint_t a, u8g_uint_t b, uint8_t option);
+uint8_t u8g_cull_quadrants(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option);
 
 void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
 void u8g_DrawDisc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option);
@@ -1388,6 +1622,11 @@ void u8g_DrawFilledEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t
 /* u8g_clip.c */
 uint8_t u8g_is_box_bbx_intersection(u8g_box_t *box, u8g_dev_arg_bbx_t *bbx);
 
+/* u8g_str_cache.c */
+void u8g_SetStrCache(u8g_t *u8g, void *mem, uint16_t size);    /* mem: pointer aligned arena for u8g_DrawStr(), NULL disables the cache */
+void u8g_ClearStrCache(u8g_t *u8g);
+uint8_t u8g_draw_str_cached(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s, u8g_uint_t *width);
+
 /* u8g_cursor.c */
 void u8g_SetCursorFont(u8g_t *u8g, const u8g_pgm_uint8_t *cursor_font);
 void u8g_SetCursorStyle(u8g_t *u8g, uint8_t encoding);
@@ -1452,10 +1691,115 @@ void u8g_AddPolygonXY(u8g_t *u8g, int16_t x, int16_t y);
 void u8g_DrawPolygon(u8g_t *u8g);
 void u8g_DrawTriangle(u8g_t *u8g, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
+/* polygons with any number of points, the edge table is owned by the caller */
+
+#define U8G_FILL_EVEN_ODD 0
+#define U8G_FILL_NON_ZERO 1
+
+typedef struct _u8g_poly_edge_t u8g_poly_edge_t;
+typedef struct _u8g_poly_t u8g_poly_t;
+
+struct _u8g_poly_edge_t
+{
+  pg_word_t y0;           /* first row */
+  pg_word_t y1;           /* last row + 1 */
+  pg_word_t x0;           /* x in row y0 */
+  pg_word_t dx;           /* x of row y1 minus x0 */
+  int8_t dir;             /* 1, if the edge goes down, -1 otherwise */
+
+  /* --- current row --- */
+  pg_word_t x;
+  u8g_poly_edge_t *next;  /* active edges sorted by x */
+};
+
+struct _u8g_poly_t
+{
+  u8g_poly_edge_t *edges; /* sorted by y0 */
+  uint16_t cnt;
+  pg_word_t min_y;
+  pg_word_t max_y;        /* last row + 1 */
+  uint8_t rule;           /* U8G_FILL_EVEN_ODD or U8G_FILL_NON_ZERO */
+};
+
+/* edges must provide space for cnt edges, returns 0 if nothing is visible */
+uint8_t u8g_InitPolygon(u8g_poly_t *poly, const struct pg_point_struct *points, uint16_t cnt, u8g_poly_edge_t *edges, uint8_t rule);
+void u8g_FillPolygon(u8g_t *u8g, u8g_poly_t *poly);
+
 /*===============================================================*/
 /* u8g_virtual_screen.c */
+
+typedef struct _u8g_vs_t u8g_vs_t;
+typedef struct _u8g_vs_tile_t u8g_vs_tile_t;
+
+/* start (or wait for) the transfer of a tile, the transfer itself is u8g_vs_FlushTile(tile) */
+typedef void (*u8g_vs_flush_fn)(u8g_vs_t *vs, u8g_vs_tile_t *tile);
+
+struct _u8g_vs_tile_t
+{
+  u8g_vs_tile_t *next;
+  u8g_t *u8g;                   /* child display */
+  u8g_uint_t x, y;              /* position of the child inside the virtual screen */
+  uint8_t bus;                  /* tiles with the same bus id are transfered one after the other */
+  volatile uint8_t is_pending;  /* transfer has been started but not yet waited for */
+  uint8_t is_done;              /* all pages of the child are transfered */
+  uint8_t is_waiting;           /* shares the page buffer of a previous tile which is not done yet */
+  uint8_t result;               /* return value of the last PAGE_NEXT */
+};
+
+struct _u8g_vs_t
+{
+  u8g_uint_t width, height;
+  u8g_vs_tile_t *first;
+  u8g_vs_tile_t *current;
+  u8g_vs_flush_fn flush_start;  /* NULL: transfer tiles synchronously */
+  u8g_vs_flush_fn flush_wait;
+  void *user_ptr;
+};
+
+#define U8G_VS_DEV(name) \
+u8g_vs_t name##_vs = { 0, 0, NULL, NULL, NULL, NULL, NULL }; \
+u8g_dev_t name = { u8g_dev_vs_fn, &name##_vs, NULL }
+
+uint8_t u8g_dev_vs_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+void u8g_InitVirtualScreenDev(u8g_dev_t *dev, u8g_vs_t *vs);
 void u8g_SetVirtualScreenDimension(u8g_t *vs_u8g, u8g_uint_t width, u8g_uint_t height);
 uint8_t u8g_AddToVirtualScreen(u8g_t *vs_u8g, u8g_uint_t x, u8g_uint_t y, u8g_t *child_u8g);
+uint8_t u8g_AddTileToVirtualScreen(u8g_t *vs_u8g, u8g_vs_tile_t *tile, u8g_uint_t x, u8g_uint_t y, u8g_t *child_u8g, uint8_t bus);
+void u8g_SetVirtualScreenFlush(u8g_t *vs_u8g, u8g_vs_flush_fn flush_start, u8g_vs_flush_fn flush_wait, void *user_ptr);
+void u8g_vs_FlushTile(u8g_vs_tile_t *tile);
+
+/*===============================================================*/
+/* u8g_mirror.c */
+
+/* page buffer layouts of the mirror children */
+#define U8G_MIRROR_V1 0     /* pb8v1, pb16v1 */
+#define U8G_MIRROR_H1 1     /* pb8h1, pb16h1, pb32h1 */
+#define U8G_MIRROR_H1F 2    /* pb8h1f */
+#define U8G_MIRROR_V2 3     /* pb8v2, pb16v2, copy only */
+#define U8G_MIRROR_H2 4     /* pb8h2, pb16h2, copy only */
+
+typedef struct _u8g_mirror_child_t u8g_mirror_child_t;
+
+struct _u8g_mirror_child_t
+{
+  u8g_mirror_child_t *next;
+  u8g_t *u8g;
+  uint8_t layout;       /* one of U8G_MIRROR_xxx */
+};
+
+struct _u8g_mirror_t
+{
+  u8g_mirror_child_t *first;  /* primary device, renders the page */
+};
+typedef struct _u8g_mirror_t u8g_mirror_t;
+
+#define U8G_MIRROR_DEV(name) \
+u8g_mirror_t name##_mirror = { NULL }; \
+u8g_dev_t name = { u8g_dev_mirror_fn, &name##_mirror, NULL }
+
+uint8_t u8g_dev_mirror_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+void u8g_InitMirrorDev(u8g_dev_t *dev, u8g_mirror_t *m);
+uint8_t u8g_AddToMirror(u8g_t *m_u8g, u8g_mirror_child_t *node, u8g_t *child_u8g, uint8_t layout);
 
 /*===============================================================*/
 void st_Draw(uint8_t fps);
@@ -1540,6 +1884,7 @@ extern const u8g_fntpgm_uint8_t u8g_font_5x8[] U8G_FONT_SECTION("u8g_font_5x8");
 extern const u8g_fntpgm_uint8_t u8g_font_5x8r[] U8G_FONT_SECTION("u8g_font_5x8r");
 extern const u8g_fntpgm_uint8_t u8g_font_6x10[] U8G_FONT_SECTION("u8g_font_6x10");
 extern const u8g_fntpgm_uint8_t u8g_font_6x10r[] U8G_FONT_SECTION("u8g_font_6x10r");
+extern const u8g_fntpgm_uint8_t u8g_font_6x10_utf8[] U8G_FONT_SECTION("u8g_font_6x10_utf8");     /* format 3, UTF-8 strings */
 extern const u8g_fntpgm_uint8_t u8g_font_6x12_67_75[] U8G_FONT_SECTION("u8g_font_6x12_67_75");
 extern const u8g_fntpgm_uint8_t u8g_font_6x12_78_79[] U8G_FONT_SECTION("u8g_font_6x12_78_79");
 extern const u8g_fntpgm_uint8_t u8g_font_6x12[] U8G_FONT_SECTION("u8g_font_6x12");
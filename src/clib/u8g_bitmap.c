@@ -44,17 +44,58 @@ void u8g_DrawHBitmap(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, con
   }
 }
 
-void u8g_DrawBitmap(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap) {
-  if (u8g_IsBBXIntersection(u8g, x, y, cnt * 8, h) == 0)
+/*
+  Draw h rows of cnt bytes each, msb is the left pixel.
+  Vertical page buffers (U8G_DEV_CAP_8X8PIXEL) receive blocks of 8 rows, which are
+  transposed into columns by the device, empty blocks are skipped. All other devices
+  receive one row of 8 pixel after the other.
+*/
+void u8g_draw_bitmap_rows(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap, uint8_t is_pgm) {
+  uint8_t rows[8];
+  uint8_t n, k, any;
+  u8g_uint_t i, ix;
+  const uint8_t *ptr;
+
+  if ((u8g->dev_caps & U8G_DEV_CAP_8X8PIXEL) == 0) {
+    while (h > 0) {
+      if (is_pgm)
+        u8g_DrawHBitmapP(u8g, x, y, cnt, (const u8g_pgm_uint8_t *)bitmap);
+      else
+        u8g_DrawHBitmap(u8g, x, y, cnt, bitmap);
+      bitmap += cnt;
+      y++;
+      h--;
+    }
     return;
+  }
+
   while (h > 0) {
-    u8g_DrawHBitmap(u8g, x, y, cnt, bitmap);
-    bitmap += cnt;
-    y++;
-    h--;
+    n = h > 8 ? 8 : h;
+    ix = x;
+    for ( i = 0; i < cnt; i++ ) {
+      ptr = bitmap + i;
+      any = 0;
+      for ( k = 0; k < n; k++ ) {
+        rows[k] = is_pgm ? u8g_pgm_read((const u8g_pgm_uint8_t *)ptr) : *ptr;
+        any |= rows[k];
+        ptr += cnt;
+      }
+      if (any != 0)
+        u8g_Draw8x8Pixel(u8g, ix, y, n, rows);
+      ix += 8;
+    }
+    bitmap += (uint16_t)n * cnt;
+    y += n;
+    h -= n;
   }
 }
 
+void u8g_DrawBitmap(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const uint8_t *bitmap) {
+  if (u8g_IsBBXIntersection(u8g, x, y, cnt * 8, h) == 0)
+    return;
+  u8g_draw_bitmap_rows(u8g, x, y, cnt, h, bitmap, 0);
+}
+
 void u8g_DrawHBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, const u8g_pgm_uint8_t *bitmap) {
   while (cnt > 0) {
     u8g_Draw8Pixel(u8g, x, y, 0, u8g_pgm_read(bitmap));
@@ -67,12 +108,7 @@ void u8g_DrawHBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, co
 void u8g_DrawBitmapP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t cnt, u8g_uint_t h, const u8g_pgm_uint8_t *bitmap) {
   if (u8g_IsBBXIntersection(u8g, x, y, cnt * 8, h) == 0)
     return;
-  while (h > 0) {
-    u8g_DrawHBitmapP(u8g, x, y, cnt, bitmap);
-    bitmap += cnt;
-    y++;
-    h--;
-  }
+  u8g_draw_bitmap_rows(u8g, x, y, cnt, h, (const uint8_t *)bitmap, 1);
 }
 
 //=========================================================================
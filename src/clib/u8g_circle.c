@@ -190,30 +190,48 @@
 
 //=========================================================================
 
-static void u8g_draw_circle_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) {
-  // upper right
-  if (option & U8G_DRAW_UPPER_RIGHT) {
-    u8g_DrawPixel(u8g, x0 + x, y0 - y);
-    u8g_DrawPixel(u8g, x0 + y, y0 - x);
-  }
+/*
+  Circles and discs (and ellipses, see u8g_ellipse.c) are drawn as horizontal
+  spans, one midpoint run per page: rows outside of the current page are
+  skipped, quadrants outside of the page are removed from the option before
+  the run.
+*/
 
-  // upper left
-  if (option & U8G_DRAW_UPPER_LEFT) {
-    u8g_DrawPixel(u8g, x0 - x, y0 - y);
-    u8g_DrawPixel(u8g, x0 - y, y0 - x);
+// pixel a..b left and/or right of x0 in row y
+static void u8g_circle_row(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y, u8g_uint_t a, u8g_uint_t b, uint8_t is_left, uint8_t is_right) {
+  if (y < u8g->current_page.y0 || y > u8g->current_page.y1)
+    return;
+  if (is_left && is_right && a == 0) {
+    u8g_draw_hline(u8g, x0 - b, y, 2 * b + 1);
+    return;
   }
+  if (is_right)
+    u8g_draw_hline(u8g, x0 + a, y, b - a + 1);
+  if (is_left)
+    u8g_draw_hline(u8g, x0 - b, y, b - a + 1);
+}
 
-  // lower right
-  if (option & U8G_DRAW_LOWER_RIGHT) {
-    u8g_DrawPixel(u8g, x0 + x, y0 + y);
-    u8g_DrawPixel(u8g, x0 + y, y0 + x);
-  }
+// pixel a..b left and/or right of x0 in the rows dy above and below y0
+void u8g_draw_quadrant_span(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t dy, u8g_uint_t a, u8g_uint_t b, uint8_t option) {
+  if (option & (U8G_DRAW_UPPER_LEFT | U8G_DRAW_UPPER_RIGHT))
+    u8g_circle_row(u8g, x0, y0 - dy, a, b, option & U8G_DRAW_UPPER_LEFT, option & U8G_DRAW_UPPER_RIGHT);
+  if (option & (U8G_DRAW_LOWER_LEFT | U8G_DRAW_LOWER_RIGHT))
+    u8g_circle_row(u8g, x0, y0 + dy, a, b, option & U8G_DRAW_LOWER_LEFT, option & U8G_DRAW_LOWER_RIGHT);
+}
 
-  // lower left
-  if (option & U8G_DRAW_LOWER_LEFT) {
-    u8g_DrawPixel(u8g, x0 - x, y0 + y);
-    u8g_DrawPixel(u8g, x0 - y, y0 + x);
-  }
+// remove the quadrants outside of the current page
+uint8_t u8g_cull_quadrants(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option) {
+  u8g_uint_t w = rx + 1;
+  u8g_uint_t h = ry + 1;
+  if (u8g_IsBBXIntersection(u8g, x0, y0 - ry, w, h) == 0)
+    option &= ~U8G_DRAW_UPPER_RIGHT;
+  if (u8g_IsBBXIntersection(u8g, x0 - rx, y0 - ry, w, h) == 0)
+    option &= ~U8G_DRAW_UPPER_LEFT;
+  if (u8g_IsBBXIntersection(u8g, x0, y0, w, h) == 0)
+    option &= ~U8G_DRAW_LOWER_RIGHT;
+  if (u8g_IsBBXIntersection(u8g, x0 - rx, y0, w, h) == 0)
+    option &= ~U8G_DRAW_LOWER_LEFT;
+  return option;
 }
 
 void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) {
@@ -222,6 +240,11 @@ void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, u
   u8g_int_t ddF_y;
   u8g_uint_t x;
   u8g_uint_t y;
+  u8g_uint_t xs;      // first x of the current y
+
+  option = u8g_cull_quadrants(u8g, x0, y0, rad, rad, option);
+  if (option == 0)
+    return;
 
   f = 1;
   f -= rad;
@@ -231,11 +254,15 @@ void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, u
   ddF_y *= 2;
   x = 0;
   y = rad;
+  xs = 0;
 
-  u8g_draw_circle_section(u8g, x, y, x0, y0, option);
+  // the points (x, y) form runs in the rows y, the points (y, x) are single pixel in the rows x
+  u8g_draw_quadrant_span(u8g, x0, y0, 0, rad, rad, option);
 
   while (x < y) {
     if (f >= 0) {
+      u8g_draw_quadrant_span(u8g, x0, y0, y, xs, x, option);
+      xs = x + 1;
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -244,8 +271,9 @@ void u8g_draw_circle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, u
     ddF_x += 2;
     f += ddF_x;
 
-    u8g_draw_circle_section(u8g, x, y, x0, y0, option);
+    u8g_draw_quadrant_span(u8g, x0, y0, x, y, y, option);
   }
+  u8g_draw_quadrant_span(u8g, x0, y0, y, xs, x, option);
 }
 
 void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) {
@@ -266,32 +294,6 @@ void u8g_DrawCircle(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, ui
   u8g_draw_circle(u8g, x0, y0, rad, option);
 }
 
-static void u8g_draw_disc_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) {
-  // upper right
-  if (option & U8G_DRAW_UPPER_RIGHT) {
-    u8g_DrawVLine(u8g, x0 + x, y0 - y, y + 1);
-    u8g_DrawVLine(u8g, x0 + y, y0 - x, x + 1);
-  }
-
-  // upper left
-  if (option & U8G_DRAW_UPPER_LEFT) {
-    u8g_DrawVLine(u8g, x0 - x, y0 - y, y + 1);
-    u8g_DrawVLine(u8g, x0 - y, y0 - x, x + 1);
-  }
-
-  // lower right
-  if (option & U8G_DRAW_LOWER_RIGHT) {
-    u8g_DrawVLine(u8g, x0 + x, y0, y + 1);
-    u8g_DrawVLine(u8g, x0 + y, y0, x + 1);
-  }
-
-  // lower left
-  if (option & U8G_DRAW_LOWER_LEFT) {
-    u8g_DrawVLine(u8g, x0 - x, y0, y + 1);
-    u8g_DrawVLine(u8g, x0 - y, y0, x + 1);
-  }
-}
-
 void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) {
   u8g_int_t f;
   u8g_int_t ddF_x;
@@ -299,6 +301,10 @@ void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uin
   u8g_uint_t x;
   u8g_uint_t y;
 
+  option = u8g_cull_quadrants(u8g, x0, y0, rad, rad, option);
+  if (option == 0)
+    return;
+
   f = 1;
   f -= rad;
   ddF_x = 1;
@@ -308,10 +314,12 @@ void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uin
   x = 0;
   y = rad;
 
-  u8g_draw_disc_section(u8g, x, y, x0, y0, option);
+  // row y extends to the last x of this y, row x extends to y
+  u8g_draw_quadrant_span(u8g, x0, y0, 0, 0, rad, option);
 
   while (x < y) {
     if (f >= 0) {
+      u8g_draw_quadrant_span(u8g, x0, y0, y, 0, x, option);
       y--;
       ddF_y += 2;
       f += ddF_y;
@@ -320,8 +328,9 @@ void u8g_draw_disc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uin
     ddF_x += 2;
     f += ddF_x;
 
-    u8g_draw_disc_section(u8g, x, y, x0, y0, option);
+    u8g_draw_quadrant_span(u8g, x0, y0, x, 0, y, option);
   }
+  u8g_draw_quadrant_span(u8g, x0, y0, y, 0, x, option);
 }
 
 void u8g_DrawDisc(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rad, uint8_t option) {
@@ -134,3 +134,17 @@ uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t
   tmp--;
   return u8g_is_intersection_decision_tree(u8g->current_page.x0, u8g->current_page.x1, x, tmp);
 }
+
+/*
+  Rows of an object at y with height h (0 for the first row) which are inside
+  the current page: r_first..r_last. Returns 0 if no row is inside the page.
+*/
+uint8_t u8g_GetPageRows(u8g_t *u8g, u8g_uint_t y, u8g_uint_t h, u8g_uint_t *r_first, u8g_uint_t *r_last) {
+  *r_first = u8g->current_page.y0 - y;
+  *r_last = u8g->current_page.y1 - y;
+  if (*r_first > *r_last)
+    *r_first = 0;             // the object starts inside the page
+  if (*r_last >= h)
+    *r_last = h - 1;
+  return *r_first <= *r_last;
+}
@@ -39,49 +39,101 @@
 
 #include "u8g.h"
 
+/*
+  Conversion for 16 gray level controllers (SSD1322, SSD1325): one byte holds two
+  pixel, the left pixel is the high nibble.
+
+  The sequence procedures convert into a staging buffer and send the whole buffer
+  with one U8G_COM_MSG_WRITE_SEQ. With the default size, a complete row of a 256
+  pixel wide display is sent at once.
+*/
+
+#ifndef U8G_16GR_STAGE_SIZE
+  #define U8G_16GR_STAGE_SIZE 128
+#endif
+
+static uint8_t u8g_16gr_stage[U8G_16GR_STAGE_SIZE];
+
+// BW: a nibble (msb is the left pixel) becomes two bytes with gray value 15 for a set pixel
+static const uint8_t u8g_16gr_bw_lut[16][2] PROGMEM = {
+  { 0x00, 0x00 }, { 0x00, 0x0f }, { 0x00, 0xf0 }, { 0x00, 0xff },
+  { 0x0f, 0x00 }, { 0x0f, 0x0f }, { 0x0f, 0xf0 }, { 0x0f, 0xff },
+  { 0xf0, 0x00 }, { 0xf0, 0x0f }, { 0xf0, 0xf0 }, { 0xf0, 0xff },
+  { 0xff, 0x00 }, { 0xff, 0x0f }, { 0xff, 0xf0 }, { 0xff, 0xff }
+};
+
+// 4L: two 2 bit pixel (lowest bits are the left pixel) become one byte with gray values 0, 4, 10 and 15
+static const uint8_t u8g_16gr_4l_lut[16] PROGMEM = {
+  0x000, 0x040, 0x0a0, 0x0f0, 0x004, 0x044, 0x0a4, 0x0f4, 0x00a, 0x04a, 0x0aa, 0x0fa, 0x00f, 0x04f, 0x0af, 0x0ff
+};
+
+// convert cnt bytes of a BW page buffer row (msb is the left pixel) into 4*cnt bytes
+void u8g_ConvertBWTo16Gr(uint8_t *dest, const uint8_t *src, uint8_t cnt) {
+  const uint8_t *p;
+  uint8_t b;
+  while (cnt > 0) {
+    b = *src++;
+    p = u8g_16gr_bw_lut[b >> 4];
+    *dest++ = u8g_pgm_read(p);
+    *dest++ = u8g_pgm_read(p + 1);
+    p = u8g_16gr_bw_lut[b & 15];
+    *dest++ = u8g_pgm_read(p);
+    *dest++ = u8g_pgm_read(p + 1);
+    cnt--;
+  }
+}
+
+// convert cnt bytes of a 2 bit page buffer row (pb8h2, pb16h2) into 2*cnt bytes
+void u8g_Convert4LTo16Gr(uint8_t *dest, const uint8_t *src, uint8_t cnt) {
+  uint8_t b;
+  while (cnt > 0) {
+    b = *src++;
+    *dest++ = u8g_pgm_read(u8g_16gr_4l_lut + (b & 15));
+    *dest++ = u8g_pgm_read(u8g_16gr_4l_lut + (b >> 4));
+    cnt--;
+  }
+}
+
 // interpret b as a monochrome bit pattern, write value 15 for high bit and value 0 for a low bit
-// topbit (msb) is sent last
-// example: b = 0x083 will send 0xff, 0x00, 0x00, 0xf0
+// topbit (msb) is sent first
+// example: b = 0x083 will send 0xf0, 0x00, 0x00, 0xff
 uint8_t u8g_WriteByteBWTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t b) {
-  static uint8_t buf[4];
-  static uint8_t map[4] = { 0, 0x00f, 0x0f0, 0x0ff };
-  buf [3] = map[b & 3];
-  b >>= 2;
-  buf [2] = map[b & 3];
-  b >>= 2;
-  buf [1] = map[b & 3];
-  b >>= 2;
-  buf [0] = map[b & 3];
-  return dev->com_fn(u8g, U8G_COM_MSG_WRITE_SEQ, 4, buf);
+  u8g_ConvertBWTo16Gr(u8g_16gr_stage, &b, 1);
+  return dev->com_fn(u8g, U8G_COM_MSG_WRITE_SEQ, 4, u8g_16gr_stage);
 }
 
 uint8_t u8g_WriteSequenceBWTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t cnt, uint8_t *ptr) {
-  do {
-    if (u8g_WriteByteBWTo16GrDevice(u8g, dev, *ptr++) == 0)
+  uint8_t n;
+  while (cnt > 0) {
+    n = cnt;
+    if (n > U8G_16GR_STAGE_SIZE / 4)
+      n = U8G_16GR_STAGE_SIZE / 4;
+    u8g_ConvertBWTo16Gr(u8g_16gr_stage, ptr, n);
+    if (dev->com_fn(u8g, U8G_COM_MSG_WRITE_SEQ, n * 4, u8g_16gr_stage) == 0)
       return 0;
-    cnt--;
-  } while (cnt != 0);
+    ptr += n;
+    cnt -= n;
+  }
   return 1;
 }
 
-// interpret b as a 4L bit pattern, write values 0x000, 0x004, 0x008, 0x00c
+// interpret b as a 4L bit pattern, write values 0x000, 0x004, 0x00a, 0x00f
 uint8_t u8g_WriteByte4LTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t b) {
-  // static uint8_t map[16] = { 0x000, 0x004, 0x008, 0x00c, 0x040, 0x044, 0x048, 0x04c, 0x080, 0x084, 0x088, 0x08c, 0x0c0, 0x0c4, 0x0c8, 0x0cc};
-  // static uint8_t map[16] = { 0x000, 0x004, 0x00a, 0x00f, 0x040, 0x044, 0x04a, 0x04f, 0x0a0, 0x0a4, 0x0aa, 0x0af, 0x0f0, 0x0f4, 0x0fa, 0x0ff};
-  static uint8_t map[16] = { 0x000, 0x040, 0x0a0, 0x0f0, 0x004, 0x044, 0x0a4, 0x0f4, 0x00a, 0x04a, 0x0aa, 0x0fa, 0x00f, 0x04f, 0x0af, 0x0ff};
-  uint8_t bb;
-  bb = b;
-  bb &= 15;
-  b >>= 4;
-  dev->com_fn(u8g, U8G_COM_MSG_WRITE_BYTE, map[bb], NULL);
-  return dev->com_fn(u8g, U8G_COM_MSG_WRITE_BYTE, map[b], NULL);
+  u8g_Convert4LTo16Gr(u8g_16gr_stage, &b, 1);
+  return dev->com_fn(u8g, U8G_COM_MSG_WRITE_SEQ, 2, u8g_16gr_stage);
 }
 
 uint8_t u8g_WriteSequence4LTo16GrDevice(u8g_t *u8g, u8g_dev_t *dev, uint8_t cnt, uint8_t *ptr) {
-  do {
-    if (u8g_WriteByte4LTo16GrDevice(u8g, dev, *ptr++) == 0)
+  uint8_t n;
+  while (cnt > 0) {
+    n = cnt;
+    if (n > U8G_16GR_STAGE_SIZE / 2)
+      n = U8G_16GR_STAGE_SIZE / 2;
+    u8g_Convert4LTo16Gr(u8g_16gr_stage, ptr, n);
+    if (dev->com_fn(u8g, U8G_COM_MSG_WRITE_SEQ, n * 2, u8g_16gr_stage) == 0)
       return 0;
-    cnt--;
-  } while (cnt != 0);
+    ptr += n;
+    cnt -= n;
+  }
   return 1;
 }
@@ -0,0 +1,90 @@
+/*
+
+  u8g_com_api_t6963.c
+
+  Page transfer for T6963 controllers.
+
+  The graphics area has width/8 bytes per row (graphics columns, cmd 0x043), so the
+  rows of a page are contiguous in display RAM. The address pointer is set once for
+  a run of rows and the data is sent with U8G_COM_MSG_WRITE_SEQ, which uses the auto
+  write mode of the controller.
+
+  Optionally (build with U8G_T6963_SHADOW), rows which did not change since the last
+  frame are skipped. The device keeps a copy of the display RAM for this, see
+  U8G_T6963_SHADOW_SIZE(): one valid bit per display row, followed by the rows. A row
+  is sent if it is not valid or differs from its copy. u8g_InitT6963Shadow() clears
+  the valid bits, so all rows are sent with the next frame. The copy needs 3856 bytes
+  for 240x128, so this is not enabled by default.
+
+*/
+
+#include "u8g.h"
+#include <string.h>
+
+static void u8g_t6963_write_run(u8g_t *u8g, u8g_dev_t *dev, uint16_t disp_ram_adr, uint8_t *ptr, uint16_t len) {
+  uint8_t n;
+
+  u8g_SetAddress(u8g, dev, 0);             // data mode
+  u8g_WriteByte(u8g, dev, disp_ram_adr & 255 );      // address low byte
+  u8g_WriteByte(u8g, dev, disp_ram_adr >> 8 );      // address hight byte
+  u8g_SetAddress(u8g, dev, 1);             // cmd mode
+  u8g_WriteByte(u8g, dev, 0x024 );        // set adr ptr
+
+  // auto write increments the address pointer, so the run can be split
+  while (len > 0) {
+    n = 255;
+    if (len < n)
+      n = len;
+    u8g_WriteSequence(u8g, dev, n, ptr);
+    ptr += n;
+    len -= n;
+  }
+}
+
+void u8g_InitT6963Shadow(uint8_t *shadow, u8g_uint_t height) {
+  if (shadow == NULL)
+    return;
+  memset(shadow, 0, ((uint16_t)height + 7) / 8);
+}
+
+/* shadow: NULL or U8G_T6963_SHADOW_SIZE(width, height) bytes */
+void u8g_WriteT6963Page(u8g_t *u8g, u8g_dev_t *dev, uint8_t *shadow) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  uint8_t row_bytes = pb->width / 8;
+  uint8_t *ptr = pb->buf;
+  uint8_t *run_ptr = ptr;
+  uint8_t *copy;
+  uint8_t mask;
+  uint16_t run_adr = 0;
+  uint16_t run_len = 0;
+  u8g_uint_t y;
+
+  u8g_SetChipSelect(u8g, dev, 1);
+  for ( y = pb->p.page_y0; y <= pb->p.page_y1; y++ ) {
+    if (shadow != NULL) {
+      mask = 1 << (y & 7);
+      copy = shadow + ((uint16_t)pb->p.total_height + 7) / 8 + (uint16_t)row_bytes * y;
+      if ((shadow[y >> 3] & mask) != 0 && memcmp(copy, ptr, row_bytes) == 0) {
+        // unchanged: send the rows collected so far
+        if (run_len != 0)
+          u8g_t6963_write_run(u8g, dev, run_adr, run_ptr, run_len);
+        run_len = 0;
+        ptr += row_bytes;
+        continue;
+      }
+      memcpy(copy, ptr, row_bytes);
+      shadow[y >> 3] |= mask;
+    }
+    if (run_len == 0) {
+      run_ptr = ptr;
+      run_adr = row_bytes;
+      run_adr *= y;
+    }
+    run_len += row_bytes;
+    ptr += row_bytes;
+  }
+  if (run_len != 0)
+    u8g_t6963_write_run(u8g, dev, run_adr, run_ptr, run_len);
+  u8g_SetAddress(u8g, dev, 0);       // data mode
+  u8g_SetChipSelect(u8g, dev, 0);
+}
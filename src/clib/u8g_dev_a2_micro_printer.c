@@ -42,6 +42,8 @@
 
 uint8_t u8g_dev_a2_micro_printer_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // the printer always gets all lines
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_NONE);
       break;
@@ -103,6 +105,8 @@ static uint8_t u8g_dev_expand4(uint8_t val) {
 
 uint8_t u8g_dev_a2_micro_printer_double_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // the printer always gets all lines
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_NONE);
       break;
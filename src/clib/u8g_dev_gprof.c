@@ -45,7 +45,7 @@
 uint8_t u8g_dev_gprof_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
 uint8_t u8g_pb_dev_gprof_buf[WIDTH];
-u8g_pb_t u8g_pb_dev_gprof = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_pb_dev_gprof_buf };
+u8g_pb_t u8g_pb_dev_gprof = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_pb_dev_gprof_buf };
 
 u8g_dev_t u8g_dev_gprof = { u8g_dev_gprof_fn, &u8g_pb_dev_gprof, NULL };
 
@@ -113,6 +113,9 @@ uint8_t u8g_dev_gprof_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_SET_COLOR_ENTRY:
       break;
     case U8G_DEV_MSG_SET_XY_CB:
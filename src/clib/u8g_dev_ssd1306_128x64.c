@@ -231,11 +231,24 @@ static const uint8_t u8g_dev_ssd13xx_sleep_off[] PROGMEM = {
   U8G_ESC_END                // end of sequence
 };
 
+// hardware scrolling: display start line 0x40..0x7f
+static uint8_t u8g_dev_ssd13xx_set_start_line(u8g_t *u8g, u8g_dev_t *dev, u8g_dev_arg_start_line_t *arg) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  if (u8g_page_SetStartLine(&(pb->p), arg) == 0)
+    return 0;
+  u8g_SetChipSelect(u8g, dev, 1);
+  u8g_SetAddress(u8g, dev, 0);          // instruction mode
+  u8g_WriteByte(u8g, dev, 0x040 | arg->line);
+  u8g_SetChipSelect(u8g, dev, 0);
+  return 1;
+}
+
 uint8_t u8g_dev_ssd1306_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_adafruit2_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -249,6 +262,8 @@ uint8_t u8g_dev_ssd1306_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void
       u8g_SetChipSelect(u8g, dev, 0);
     }
     break;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_ssd13xx_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);
       return 1;
@@ -264,6 +279,7 @@ uint8_t u8g_dev_ssd1306_adafruit_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -277,6 +293,8 @@ uint8_t u8g_dev_ssd1306_adafruit_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
       u8g_SetChipSelect(u8g, dev, 0);
     }
     break;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_ssd13xx_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);
       return 1;
@@ -292,6 +310,7 @@ uint8_t u8g_dev_sh1106_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -305,6 +324,8 @@ uint8_t u8g_dev_sh1106_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *
       u8g_SetChipSelect(u8g, dev, 0);
     }
     break;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_ssd13xx_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);
       return 1;
@@ -320,6 +341,7 @@ uint8_t u8g_dev_ssd1306_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -339,6 +361,8 @@ uint8_t u8g_dev_ssd1306_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       u8g_SetChipSelect(u8g, dev, 0);
     }
     break;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_ssd13xx_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);
       return 1;
@@ -354,6 +378,7 @@ uint8_t u8g_dev_sh1106_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, voi
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_300NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1306_128x64_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -373,6 +398,8 @@ uint8_t u8g_dev_sh1106_128x64_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, voi
       u8g_SetChipSelect(u8g, dev, 0);
     }
     break;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_ssd13xx_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd13xx_sleep_on);
       return 1;
@@ -392,7 +419,7 @@ U8G_PB_DEV(u8g_dev_ssd1306_adafruit_128x64_hw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u
 U8G_PB_DEV(u8g_dev_ssd1306_adafruit_128x64_i2c, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_ssd1306_adafruit_128x64_fn, U8G_COM_SSD_I2C);
 
 uint8_t u8g_dev_ssd1306_128x64_2x_buf[WIDTH * 2] U8G_NOCOMMON;
-u8g_pb_t u8g_dev_ssd1306_128x64_2x_pb = { {16, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1306_128x64_2x_buf};
+u8g_pb_t u8g_dev_ssd1306_128x64_2x_pb = { {16, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1306_128x64_2x_buf};
 u8g_dev_t u8g_dev_ssd1306_128x64_2x_sw_spi = { u8g_dev_ssd1306_128x64_2x_fn, &u8g_dev_ssd1306_128x64_2x_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1306_128x64_2x_hw_spi = { u8g_dev_ssd1306_128x64_2x_fn, &u8g_dev_ssd1306_128x64_2x_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1306_128x64_2x_i2c = { u8g_dev_ssd1306_128x64_2x_fn, &u8g_dev_ssd1306_128x64_2x_pb, U8G_COM_SSD_I2C };
@@ -402,7 +429,7 @@ U8G_PB_DEV(u8g_dev_sh1106_128x64_hw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_sh1
 U8G_PB_DEV(u8g_dev_sh1106_128x64_i2c, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_sh1106_128x64_fn, U8G_COM_SSD_I2C);
 
 uint8_t u8g_dev_sh1106_128x64_2x_buf[WIDTH * 2] U8G_NOCOMMON;
-u8g_pb_t u8g_dev_sh1106_128x64_2x_pb = { {16, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_sh1106_128x64_2x_buf};
+u8g_pb_t u8g_dev_sh1106_128x64_2x_pb = { {16, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_sh1106_128x64_2x_buf};
 u8g_dev_t u8g_dev_sh1106_128x64_2x_sw_spi = { u8g_dev_sh1106_128x64_2x_fn, &u8g_dev_sh1106_128x64_2x_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_sh1106_128x64_2x_hw_spi = { u8g_dev_sh1106_128x64_2x_fn, &u8g_dev_sh1106_128x64_2x_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_sh1106_128x64_2x_i2c = { u8g_dev_sh1106_128x64_2x_fn, &u8g_dev_sh1106_128x64_2x_pb, U8G_COM_SSD_I2C };
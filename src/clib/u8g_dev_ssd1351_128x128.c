@@ -417,19 +417,83 @@ static const uint8_t u8g_dev_ssd1351_128x128_column_seq[] PROGMEM = {
   U8G_ESC_END
 };
 
-#define RGB332_STREAM_BYTES 8
-static uint8_t u8g_ssd1351_stream_bytes[RGB332_STREAM_BYTES * 3];
+/*
+  The page is converted into the 18 bit (666) stream of the controller in chunks of
+  U8G_SSD1351_STREAM_PIXEL pixel, each chunk is sent with one u8g_WriteSequence().
+  The chunk buffer needs 3 bytes per pixel: the default of 8 pixel keeps the 24 bytes
+  of RAM of the former buffer. 64 pixel (192 bytes) send a 128 pixel row with 2 calls
+  instead of 16. The count argument of u8g_WriteSequence() is 8 bit, so a chunk has
+  at most 85 pixel.
+*/
+#ifndef U8G_SSD1351_STREAM_PIXEL
+  #define U8G_SSD1351_STREAM_PIXEL 8
+#endif
+#if U8G_SSD1351_STREAM_PIXEL < 1 || U8G_SSD1351_STREAM_PIXEL > 85
+  #error "U8G_SSD1351_STREAM_PIXEL must be between 1 and 85"
+#endif
+static uint8_t u8g_ssd1351_stream_bytes[U8G_SSD1351_STREAM_PIXEL * 3];
 
-void u8g_ssd1351_to_stream(uint8_t *ptr) {
-  uint8_t cnt = RGB332_STREAM_BYTES;
+static void u8g_ssd1351_to_stream(const uint8_t *ptr, uint8_t cnt) {
   uint8_t val;
   uint8_t *dest = u8g_ssd1351_stream_bytes;
-  for ( cnt = 0; cnt < RGB332_STREAM_BYTES; cnt++ ) {
+  do {
     val = *ptr++;
     *dest++ = ((val & 0xe0) >> 2);
     *dest++ = ((val & 0x1c) << 1);
     *dest++ = ((val & 0x03) << 4);
+    cnt--;
+  } while (cnt != 0);
+}
+
+// pbxh16: low byte first, 565
+static void u8g_ssd1351_hicolor_to_stream(const uint8_t *ptr, uint8_t cnt) {
+  register uint8_t low, high, r, g, b;
+  uint8_t *dest = u8g_ssd1351_stream_bytes;
+  do {
+    low = *ptr++;
+    high = *ptr++;
+
+    r = high & ~7;
+    r >>= 2;
+    b = low & 31;
+    b <<= 1;
+    g = high & 7;
+    g <<= 3;
+    g |= (low >> 5) & 7;
+
+    *dest++ = r;
+    *dest++ = g;
+    *dest++ = b;
+    cnt--;
+  } while (cnt != 0);
+}
+
+// send all rows of the current page, bytes_per_pixel is 1 (332) or 2 (hicolor)
+static void u8g_ssd1351_write_page(u8g_t *u8g, u8g_dev_t *dev, uint8_t bytes_per_pixel) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  uint8_t *ptr = pb->buf;
+  uint16_t cnt;
+  uint8_t n;
+
+  cnt = pb->p.page_y1;
+  cnt -= pb->p.page_y0;
+  cnt++;
+  cnt *= pb->width;
+
+  u8g_SetChipSelect(u8g, dev, 1);
+  while (cnt > 0) {
+    n = U8G_SSD1351_STREAM_PIXEL;
+    if (cnt < n)
+      n = cnt;
+    if (bytes_per_pixel == 1)
+      u8g_ssd1351_to_stream(ptr, n);
+    else
+      u8g_ssd1351_hicolor_to_stream(ptr, n);
+    u8g_WriteSequence(u8g, dev, n * 3, u8g_ssd1351_stream_bytes);
+    ptr += n * bytes_per_pixel;
+    cnt -= n;
   }
+  u8g_SetChipSelect(u8g, dev, 0);
 }
 
 #ifdef OBSOLETE
@@ -458,6 +522,8 @@ uint8_t u8g_dev_ssd1351_128x128_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
   //    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_init_seq);
@@ -470,30 +536,9 @@ uint8_t u8g_dev_ssd1351_128x128_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_column_seq);
       break;
 
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_uint_t x;
-      uint8_t page_height;
-      uint8_t i;
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( i = 0; i < page_height; i++ ) {
-
-        for (x = 0; x < pb->width; x += RGB332_STREAM_BYTES) {
-          u8g_ssd1351_to_stream(ptr);
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1351_stream_bytes);
-          ptr += RGB332_STREAM_BYTES;
-        }
-      }
-      u8g_SetChipSelect(u8g, dev, 0);
-    }
-
-    break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1351_write_page(u8g, dev, 1);
+      break;
     case U8G_DEV_MSG_GET_MODE:
       return U8G_MODE_R3G3B2;
   }
@@ -505,6 +550,8 @@ uint8_t u8g_dev_ssd1351_128x128gh_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg
   //    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128gh_init_seq);
@@ -517,30 +564,9 @@ uint8_t u8g_dev_ssd1351_128x128gh_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_column_seq);
       break;
 
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_uint_t x;
-      uint8_t page_height;
-      uint8_t i;
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( i = 0; i < page_height; i++ ) {
-
-        for (x = 0; x < pb->width; x += RGB332_STREAM_BYTES) {
-          u8g_ssd1351_to_stream(ptr);
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1351_stream_bytes);
-          ptr += RGB332_STREAM_BYTES;
-        }
-      }
-      u8g_SetChipSelect(u8g, dev, 0);
-    }
-
-    break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1351_write_page(u8g, dev, 1);
+      break;
     case U8G_DEV_MSG_GET_MODE:
       return U8G_MODE_R3G3B2;
   }
@@ -556,6 +582,8 @@ uint8_t u8g_dev_ssd1351_128x128_idx_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
   //    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_init_seq);
@@ -600,30 +628,10 @@ uint8_t u8g_dev_ssd1351_128x128_idx_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
   return u8g_dev_pb8h8_base_fn(u8g, dev, msg, arg);
 }
 
-void u8g_ssd1351_hicolor_to_stream(uint8_t *ptr) {
-  register uint8_t cnt = RGB332_STREAM_BYTES;
-  register uint8_t low, high, r, g, b;
-  uint8_t *dest = u8g_ssd1351_stream_bytes;
-  for ( cnt = 0; cnt < RGB332_STREAM_BYTES; cnt++ ) {
-    low = *ptr++;
-    high = *ptr++;
-
-    r = high & ~7;
-    r >>= 2;
-    b = low & 31;
-    b <<= 1;
-    g = high & 7;
-    g <<= 3;
-    g |= (low >> 5) & 7;
-
-    *dest++ = r;
-    *dest++ = g;
-    *dest++ = b;
-  }
-}
-
 uint8_t u8g_dev_ssd1351_128x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_init_seq);
@@ -633,30 +641,9 @@ uint8_t u8g_dev_ssd1351_128x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
     case U8G_DEV_MSG_PAGE_FIRST:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_column_seq);
       break;
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t i, j;
-      uint8_t page_height;
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( j = 0; j < page_height; j++ ) {
-        for (i = 0; i < pb->width; i += RGB332_STREAM_BYTES) {
-          u8g_ssd1351_hicolor_to_stream(ptr);
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1351_stream_bytes);
-          ptr += RGB332_STREAM_BYTES * 2;
-        }
-
-      }
-
-      u8g_SetChipSelect(u8g, dev, 0);
-
-    }
-    break;      // continue to base fn
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1351_write_page(u8g, dev, 2);
+      break;      // continue to base fn
     case U8G_DEV_MSG_GET_MODE:
       return U8G_MODE_HICOLOR;
   }
@@ -665,6 +652,8 @@ uint8_t u8g_dev_ssd1351_128x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
 
 uint8_t u8g_dev_ssd1351_128x128gh_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128gh_init_seq);
@@ -674,30 +663,9 @@ uint8_t u8g_dev_ssd1351_128x128gh_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t
     case U8G_DEV_MSG_PAGE_FIRST:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1351_128x128_column_seq);
       break;
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t i, j;
-      uint8_t page_height;
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( j = 0; j < page_height; j++ ) {
-        for (i = 0; i < pb->width; i += RGB332_STREAM_BYTES) {
-          u8g_ssd1351_hicolor_to_stream(ptr);
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1351_stream_bytes);
-          ptr += RGB332_STREAM_BYTES * 2;
-        }
-
-      }
-
-      u8g_SetChipSelect(u8g, dev, 0);
-
-    }
-    break;      // continue to base fn
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1351_write_page(u8g, dev, 2);
+      break;      // continue to base fn
     case U8G_DEV_MSG_GET_MODE:
       return U8G_MODE_HICOLOR;
   }
@@ -706,7 +674,7 @@ uint8_t u8g_dev_ssd1351_128x128gh_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t
 
 uint8_t u8g_dev_ssd1351_128x128_byte_buf[WIDTH * PAGE_HEIGHT] U8G_NOCOMMON;
 
-u8g_pb_t u8g_dev_ssd1351_128x128_byte_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_byte_buf};
+u8g_pb_t u8g_dev_ssd1351_128x128_byte_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_byte_buf};
 u8g_dev_t u8g_dev_ssd1351_128x128_332_sw_spi = { u8g_dev_ssd1351_128x128_332_fn, &u8g_dev_ssd1351_128x128_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128_332_hw_spi = { u8g_dev_ssd1351_128x128_332_fn, &u8g_dev_ssd1351_128x128_byte_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128gh_332_sw_spi = { u8g_dev_ssd1351_128x128gh_332_fn, &u8g_dev_ssd1351_128x128_byte_pb, U8G_COM_SW_SPI };
@@ -716,7 +684,7 @@ u8g_dev_t u8g_dev_ssd1351_128x128gh_332_hw_spi = { u8g_dev_ssd1351_128x128gh_332
 // u8g_dev_t u8g_dev_ssd1351_128x128_idx_hw_spi = { u8g_dev_ssd1351_128x128_idx_fn, &u8g_dev_ssd1351_128x128_byte_pb, U8G_COM_HW_SPI };
 
 // only half of the height, because two bytes are needed for one pixel
-u8g_pb_t u8g_dev_ssd1351_128x128_hicolor_byte_pb = { {PAGE_HEIGHT / 2, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_byte_buf};
+u8g_pb_t u8g_dev_ssd1351_128x128_hicolor_byte_pb = { {PAGE_HEIGHT / 2, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_byte_buf};
 u8g_dev_t u8g_dev_ssd1351_128x128_hicolor_sw_spi = { u8g_dev_ssd1351_128x128_hicolor_fn, &u8g_dev_ssd1351_128x128_hicolor_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128_hicolor_hw_spi = { u8g_dev_ssd1351_128x128_hicolor_fn, &u8g_dev_ssd1351_128x128_hicolor_byte_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128gh_hicolor_sw_spi = { u8g_dev_ssd1351_128x128gh_hicolor_fn, &u8g_dev_ssd1351_128x128_hicolor_byte_pb, U8G_COM_SW_SPI };
@@ -724,13 +692,13 @@ u8g_dev_t u8g_dev_ssd1351_128x128gh_hicolor_hw_spi = { u8g_dev_ssd1351_128x128gh
 
 uint8_t u8g_dev_ssd1351_128x128_4x_byte_buf[WIDTH * PAGE_HEIGHT * 4] U8G_NOCOMMON;
 
-u8g_pb_t u8g_dev_ssd1351_128x128_4x_332_byte_pb = { {PAGE_HEIGHT*4, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_4x_byte_buf};
+u8g_pb_t u8g_dev_ssd1351_128x128_4x_332_byte_pb = { {PAGE_HEIGHT*4, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_4x_byte_buf};
 u8g_dev_t u8g_dev_ssd1351_128x128_4x_332_sw_spi = { u8g_dev_ssd1351_128x128_332_fn, &u8g_dev_ssd1351_128x128_4x_332_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128_4x_332_hw_spi = { u8g_dev_ssd1351_128x128_332_fn, &u8g_dev_ssd1351_128x128_4x_332_byte_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128gh_4x_332_sw_spi = { u8g_dev_ssd1351_128x128gh_332_fn, &u8g_dev_ssd1351_128x128_4x_332_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128gh_4x_332_hw_spi = { u8g_dev_ssd1351_128x128gh_332_fn, &u8g_dev_ssd1351_128x128_4x_332_byte_pb, U8G_COM_HW_SPI };
 
-u8g_pb_t u8g_dev_ssd1351_128x128_4x_hicolor_byte_pb = { {PAGE_HEIGHT / 2 * 4, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_4x_byte_buf};
+u8g_pb_t u8g_dev_ssd1351_128x128_4x_hicolor_byte_pb = { {PAGE_HEIGHT / 2 * 4, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1351_128x128_4x_byte_buf};
 u8g_dev_t u8g_dev_ssd1351_128x128_4x_hicolor_sw_spi = { u8g_dev_ssd1351_128x128_hicolor_fn, &u8g_dev_ssd1351_128x128_4x_hicolor_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128_4x_hicolor_hw_spi = { u8g_dev_ssd1351_128x128_hicolor_fn, &u8g_dev_ssd1351_128x128_4x_hicolor_byte_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_ssd1351_128x128gh_4x_hicolor_sw_spi = { u8g_dev_ssd1351_128x128gh_hicolor_fn, &u8g_dev_ssd1351_128x128_4x_hicolor_byte_pb, U8G_COM_SW_SPI };
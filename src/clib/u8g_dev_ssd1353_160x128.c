@@ -201,11 +201,89 @@ static const uint8_t u8g_dev_ssd1353_160x128_sleep_off[] PROGMEM = {
   U8G_ESC_END
 };
 
-#define RGB332_STREAM_BYTES 8
-static uint8_t u8g_ssd1353_stream_bytes[RGB332_STREAM_BYTES * 3];
+/*
+  The page is converted into the 18 bit (666) stream of the controller in chunks of
+  U8G_SSD1353_STREAM_PIXEL pixel, each chunk is sent with one u8g_WriteSequence().
+  The chunk buffer needs 3 bytes per pixel: the default of 8 pixel keeps the 24 bytes
+  of RAM of the former buffer. 80 pixel (240 bytes) send a 160 pixel row with 2 calls
+  instead of 20. The count argument of u8g_WriteSequence() is 8 bit, so a chunk has
+  at most 85 pixel.
+*/
+#ifndef U8G_SSD1353_STREAM_PIXEL
+  #define U8G_SSD1353_STREAM_PIXEL 8
+#endif
+#if U8G_SSD1353_STREAM_PIXEL < 1 || U8G_SSD1353_STREAM_PIXEL > 85
+  #error "U8G_SSD1353_STREAM_PIXEL must be between 1 and 85"
+#endif
+static uint8_t u8g_ssd1353_stream_bytes[U8G_SSD1353_STREAM_PIXEL * 3];
+
+static void u8g_ssd1353_to_stream(const uint8_t *ptr, uint8_t cnt) {
+  uint8_t val;
+  uint8_t *dest = u8g_ssd1353_stream_bytes;
+  do {
+    val = *ptr++;
+    *dest++ = ((val & 0xe0) >> 2);
+    *dest++ = ((val & 0x1c) << 1);
+    *dest++ = ((val & 0x03) << 4);
+    cnt--;
+  } while (cnt != 0);
+}
+
+// pbxh16: low byte first, 565
+static void u8g_ssd1353_hicolor_to_stream(const uint8_t *ptr, uint8_t cnt) {
+  register uint8_t low, high, r, g, b;
+  uint8_t *dest = u8g_ssd1353_stream_bytes;
+  do {
+    low = *ptr++;
+    high = *ptr++;
+
+    r = high & ~7;
+    r >>= 2;
+    b = low & 31;
+    b <<= 1;
+    g = high & 7;
+    g <<= 3;
+    g |= (low >> 5) & 7;
+
+    *dest++ = r;
+    *dest++ = g;
+    *dest++ = b;
+    cnt--;
+  } while (cnt != 0);
+}
+
+// send all rows of the current page, bytes_per_pixel is 1 (332) or 2 (hicolor)
+static void u8g_ssd1353_write_page(u8g_t *u8g, u8g_dev_t *dev, uint8_t bytes_per_pixel) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  uint8_t *ptr = pb->buf;
+  uint16_t cnt;
+  uint8_t n;
+
+  cnt = pb->p.page_y1;
+  cnt -= pb->p.page_y0;
+  cnt++;
+  cnt *= pb->width;
+
+  u8g_SetChipSelect(u8g, dev, 1);
+  while (cnt > 0) {
+    n = U8G_SSD1353_STREAM_PIXEL;
+    if (cnt < n)
+      n = cnt;
+    if (bytes_per_pixel == 1)
+      u8g_ssd1353_to_stream(ptr, n);
+    else
+      u8g_ssd1353_hicolor_to_stream(ptr, n);
+    u8g_WriteSequence(u8g, dev, n * 3, u8g_ssd1353_stream_bytes);
+    ptr += n * bytes_per_pixel;
+    cnt -= n;
+  }
+  u8g_SetChipSelect(u8g, dev, 0);
+}
 
 uint8_t u8g_dev_ssd1353_160x128_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_init_seq);
@@ -218,37 +296,9 @@ uint8_t u8g_dev_ssd1353_160x128_332_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_column_seq);
       break;
 
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_uint_t x;
-      uint8_t page_height;
-      uint8_t i;
-      uint8_t cnt;
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( i = 0; i < page_height; i++ ) {
-
-        for (x = 0; x < pb->width; x += RGB332_STREAM_BYTES) {
-          // inline operation for better perf
-          uint8_t *dest = u8g_ssd1353_stream_bytes;
-          for ( cnt = 0; cnt < RGB332_STREAM_BYTES; cnt++ ) {
-            uint8_t val = *ptr++;
-            *dest++ = ((val & 0xe0) >> 2);
-            *dest++ = ((val & 0x1c) << 1);
-            *dest++ = ((val & 0x03) << 4);
-          }
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1353_stream_bytes);
-        }
-      }
-      u8g_SetChipSelect(u8g, dev, 0);
-    }
-
-    break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1353_write_page(u8g, dev, 1);
+      break;
 
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_sleep_on);
@@ -272,6 +322,8 @@ uint8_t u8g_dev_ssd1353_160x128_idx_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
   //    u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
 
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_init_seq);
@@ -318,6 +370,8 @@ uint8_t u8g_dev_ssd1353_160x128_idx_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg,
 
 uint8_t u8g_dev_ssd1353_160x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      return 1;   // all pages are streamed into one window
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_50NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_init_seq);
@@ -327,43 +381,9 @@ uint8_t u8g_dev_ssd1353_160x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
     case U8G_DEV_MSG_PAGE_FIRST:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_column_seq);
       break;
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-      uint8_t i, j;
-      uint8_t page_height;
-      uint8_t *ptr = pb->buf;
-
-      u8g_SetChipSelect(u8g, dev, 1);
-
-      page_height = pb->p.page_y1;
-      page_height -= pb->p.page_y0;
-      page_height++;
-      for ( j = 0; j < page_height; j++ ) {
-        for (i = 0; i < pb->width; i += RGB332_STREAM_BYTES) {
-          register uint8_t cnt, low, high, r, g, b;
-          uint8_t *dest = u8g_ssd1353_stream_bytes;
-          for ( cnt = 0; cnt < RGB332_STREAM_BYTES; cnt++ ) {
-            low = *ptr++;
-            high = *ptr++;
-
-            r = high & ~7;
-            r >>= 2;
-            b = low & 31;
-            b <<= 1;
-            g = high & 7;
-            g <<= 3;
-            g |= (low >> 5) & 7;
-
-            *dest++ = r;
-            *dest++ = g;
-            *dest++ = b;
-          }
-          u8g_WriteSequence(u8g, dev, RGB332_STREAM_BYTES * 3, u8g_ssd1353_stream_bytes);
-        }
-      }
-      u8g_SetChipSelect(u8g, dev, 0);
-    }
-    break;      // continue to base fn
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_ssd1353_write_page(u8g, dev, 2);
+      break;      // continue to base fn
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_ssd1353_160x128_sleep_on);
       break;
@@ -376,7 +396,7 @@ uint8_t u8g_dev_ssd1353_160x128_hicolor_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t m
 
 uint8_t u8g_dev_ssd1353_160x128_byte_buf[WIDTH * PAGE_HEIGHT] U8G_NOCOMMON;
 
-u8g_pb_t u8g_dev_ssd1353_160x128_byte_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_byte_buf};
+u8g_pb_t u8g_dev_ssd1353_160x128_byte_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_byte_buf};
 u8g_dev_t u8g_dev_ssd1353_160x128_332_sw_spi = { u8g_dev_ssd1353_160x128_332_fn, &u8g_dev_ssd1353_160x128_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1353_160x128_332_hw_spi = { u8g_dev_ssd1353_160x128_332_fn, &u8g_dev_ssd1353_160x128_byte_pb, U8G_COM_HW_SPI };
 
@@ -384,7 +404,7 @@ u8g_dev_t u8g_dev_ssd1353_160x128_332_hw_spi = { u8g_dev_ssd1353_160x128_332_fn,
 // u8g_dev_t u8g_dev_ssd1353_160x128_idx_hw_spi = { u8g_dev_ssd1353_160x128_idx_fn, &u8g_dev_ssd1353_160x128_byte_pb, U8G_COM_HW_SPI };
 
 // only half of the height, because two bytes are needed for one pixel
-u8g_pb_t u8g_dev_ssd1353_160x128_hicolor_byte_pb = { {PAGE_HEIGHT / 2, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_byte_buf};
+u8g_pb_t u8g_dev_ssd1353_160x128_hicolor_byte_pb = { {PAGE_HEIGHT / 2, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_byte_buf};
 u8g_dev_t u8g_dev_ssd1353_160x128_hicolor_sw_spi = { u8g_dev_ssd1353_160x128_hicolor_fn, &u8g_dev_ssd1353_160x128_hicolor_byte_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_ssd1353_160x128_hicolor_hw_spi = { u8g_dev_ssd1353_160x128_hicolor_fn, &u8g_dev_ssd1353_160x128_hicolor_byte_pb, U8G_COM_HW_SPI };
 
@@ -392,11 +412,11 @@ u8g_dev_t u8g_dev_ssd1353_160x128_hicolor_hw_spi = { u8g_dev_ssd1353_160x128_hic
 #if 0
   uint8_t u8g_dev_ssd1353_160x128_4x_byte_buf[WIDTH * PAGE_HEIGHT * 4] U8G_NOCOMMON;
 
-  u8g_pb_t u8g_dev_ssd1353_160x128_4x_332_byte_pb = { {PAGE_HEIGHT*4, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_4x_byte_buf};
+  u8g_pb_t u8g_dev_ssd1353_160x128_4x_332_byte_pb = { {PAGE_HEIGHT*4, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_4x_byte_buf};
   u8g_dev_t u8g_dev_ssd1353_160x128_4x_332_sw_spi = { u8g_dev_ssd1353_160x128_332_fn, &u8g_dev_ssd1353_160x128_4x_332_byte_pb, U8G_COM_SW_SPI };
   u8g_dev_t u8g_dev_ssd1353_160x128_4x_332_hw_spi = { u8g_dev_ssd1353_160x128_332_fn, &u8g_dev_ssd1353_160x128_4x_332_byte_pb, U8G_COM_HW_SPI };
 
-  u8g_pb_t u8g_dev_ssd1353_160x128_4x_hicolor_byte_pb = { {PAGE_HEIGHT / 2 * 4, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_4x_byte_buf};
+  u8g_pb_t u8g_dev_ssd1353_160x128_4x_hicolor_byte_pb = { {PAGE_HEIGHT / 2 * 4, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_ssd1353_160x128_4x_byte_buf};
   u8g_dev_t u8g_dev_ssd1353_160x128_4x_hicolor_sw_spi = { u8g_dev_ssd1353_160x128_hicolor_fn, &u8g_dev_ssd1353_160x128_4x_hicolor_byte_pb, U8G_COM_SW_SPI };
   u8g_dev_t u8g_dev_ssd1353_160x128_4x_hicolor_hw_spi = { u8g_dev_ssd1353_160x128_hicolor_fn, &u8g_dev_ssd1353_160x128_4x_hicolor_byte_pb, U8G_COM_HW_SPI };
 #endif
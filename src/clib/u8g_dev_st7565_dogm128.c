@@ -95,11 +95,24 @@ static const uint8_t u8g_dev_st7565_dogm128_sleep_off[] PROGMEM = {
   U8G_ESC_END                // end of sequence
 };
 
+// hardware scrolling: display start line 0x40..0x7f
+static uint8_t u8g_dev_st7565_dogm128_set_start_line(u8g_t *u8g, u8g_dev_t *dev, u8g_dev_arg_start_line_t *arg) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  if (u8g_page_SetStartLine(&(pb->p), arg) == 0)
+    return 0;
+  u8g_SetChipSelect(u8g, dev, 1);
+  u8g_SetAddress(u8g, dev, 0);          // instruction mode
+  u8g_WriteByte(u8g, dev, 0x040 | arg->line);
+  u8g_SetChipSelect(u8g, dev, 0);
+  return 1;
+}
+
 uint8_t u8g_dev_st7565_dogm128_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_dogm128_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -120,6 +133,8 @@ uint8_t u8g_dev_st7565_dogm128_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void
       u8g_WriteByte(u8g, dev, (*(uint8_t *)arg) >> 2);
       u8g_SetChipSelect(u8g, dev, 0);
       return 1;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_st7565_dogm128_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_dogm128_sleep_on);
       return 1;
@@ -135,6 +150,7 @@ uint8_t u8g_dev_st7565_dogm128_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_400NS);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_dogm128_init_seq);
+      u8g_page_InitStartLine(&(((u8g_pb_t *)(dev->dev_mem))->p));
       break;
     case U8G_DEV_MSG_STOP:
       break;
@@ -161,6 +177,8 @@ uint8_t u8g_dev_st7565_dogm128_2x_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, vo
       u8g_WriteByte(u8g, dev, (*(uint8_t *)arg) >> 2);
       u8g_SetChipSelect(u8g, dev, 0);
       return 1;
+    case U8G_DEV_MSG_SET_START_LINE:
+      return u8g_dev_st7565_dogm128_set_start_line(u8g, dev, (u8g_dev_arg_start_line_t *)arg);
     case U8G_DEV_MSG_SLEEP_ON:
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_st7565_dogm128_sleep_on);
       return 1;
@@ -176,7 +194,7 @@ U8G_PB_DEV(u8g_dev_st7565_dogm128_hw_spi, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_st
 U8G_PB_DEV(u8g_dev_st7565_dogm128_parallel, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_st7565_dogm128_fn, U8G_COM_PARALLEL);
 
 uint8_t u8g_dev_st7565_dogm128_2x_buf[WIDTH * 2] U8G_NOCOMMON;
-u8g_pb_t u8g_dev_st7565_dogm128_2x_pb = { {16, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_st7565_dogm128_2x_buf};
+u8g_pb_t u8g_dev_st7565_dogm128_2x_pb = { {16, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_st7565_dogm128_2x_buf};
 u8g_dev_t u8g_dev_st7565_dogm128_2x_sw_spi = { u8g_dev_st7565_dogm128_2x_fn, &u8g_dev_st7565_dogm128_2x_pb, U8G_COM_SW_SPI };
 u8g_dev_t u8g_dev_st7565_dogm128_2x_hw_spi = { u8g_dev_st7565_dogm128_2x_fn, &u8g_dev_st7565_dogm128_2x_pb, U8G_COM_HW_SPI };
 u8g_dev_t u8g_dev_st7565_dogm128_2x_parallel = { u8g_dev_st7565_dogm128_2x_fn, &u8g_dev_st7565_dogm128_2x_pb, U8G_COM_PARALLEL };
@@ -133,42 +133,26 @@ static const uint8_t u8g_dev_t6963_128x64_init_seq[] PROGMEM = {
   U8G_ESC_END                // end of sequence
 };
 
+// copy of the display RAM, unchanged rows are not transfered
+#ifdef U8G_T6963_SHADOW
+  static uint8_t u8g_dev_t6963_128x64_shadow[U8G_T6963_SHADOW_SIZE(WIDTH, HEIGHT)];
+  #define U8G_T6963_SHADOW_BUF u8g_dev_t6963_128x64_shadow
+#else
+  #define U8G_T6963_SHADOW_BUF NULL
+#endif
+
 uint8_t u8g_dev_t6963_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   switch (msg) {
     case U8G_DEV_MSG_INIT:
       u8g_InitCom(u8g, dev, U8G_SPI_CLK_CYCLE_NONE);
       u8g_WriteEscSeqP(u8g, dev, u8g_dev_t6963_128x64_init_seq);
+      u8g_InitT6963Shadow(U8G_T6963_SHADOW_BUF, HEIGHT);
       break;
     case U8G_DEV_MSG_STOP:
       break;
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      uint8_t y, i;
-      uint16_t disp_ram_adr;
-      uint8_t *ptr;
-      u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
-
-      u8g_SetAddress(u8g, dev, 0);       // data mode
-      u8g_SetChipSelect(u8g, dev, 1);
-      y = pb->p.page_y0;
-      ptr = pb->buf;
-      disp_ram_adr = WIDTH / 8;
-      disp_ram_adr *= y;
-      for ( i = 0; i < PAGE_HEIGHT; i++ ) {
-        u8g_SetAddress(u8g, dev, 0);             // data mode
-        u8g_WriteByte(u8g, dev, disp_ram_adr & 255 );      // address low byte
-        u8g_WriteByte(u8g, dev, disp_ram_adr >> 8 );      // address hight byte
-        u8g_SetAddress(u8g, dev, 1);             // cmd mode
-        u8g_WriteByte(u8g, dev, 0x024 );        // set adr ptr
-
-        u8g_WriteSequence(u8g, dev, WIDTH / 8, ptr);
-
-        ptr += WIDTH / 8;
-        disp_ram_adr += WIDTH / 8;
-      }
-      u8g_SetAddress(u8g, dev, 0);       // data mode
-      u8g_SetChipSelect(u8g, dev, 0);
-    }
-    break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      u8g_WriteT6963Page(u8g, dev, U8G_T6963_SHADOW_BUF);
+      break;
   }
   return u8g_dev_pb16h1_base_fn(u8g, dev, msg, arg);
 }
@@ -176,5 +160,5 @@ uint8_t u8g_dev_t6963_128x64_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *a
 // U8G_PB_DEV(u8g_dev_t6963_128x64_8bit, WIDTH, HEIGHT, PAGE_HEIGHT, u8g_dev_t6963_128x64_fn, U8G_COM_T6963);
 
 uint8_t u8g_dev_t6963_128x64_2x_bw_buf[WIDTH / 8 * PAGE_HEIGHT] U8G_NOCOMMON;
-u8g_pb_t u8g_dev_t6963_128x64_2x_bw_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_dev_t6963_128x64_2x_bw_buf};
+u8g_pb_t u8g_dev_t6963_128x64_2x_bw_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_dev_t6963_128x64_2x_bw_buf};
 u8g_dev_t u8g_dev_t6963_128x64_8bit = { u8g_dev_t6963_128x64_fn, &u8g_dev_t6963_128x64_2x_bw_pb, U8G_COM_T6963 };
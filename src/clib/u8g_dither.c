@@ -0,0 +1,143 @@
+/*
+
+  u8g_dither.c
+
+  Dithering of 8 bit gray (0: off, 255: full intensity) or R3G3B2 images into
+  the current page: 1 bit for monochrome displays, 2 and 4 bit for gray
+  displays (color index 0..3 or 0..15). Set pixel are drawn, pixel with
+  level 0 keep the content of the page.
+
+  The image is read row by row with a callback, only the rows of the current
+  page are requested. U8G_DITHER_BAYER uses a 4x4 threshold matrix.
+  U8G_DITHER_FLOYD_STEINBERG keeps the error of one row in a buffer of the
+  caller: rows are processed from top to bottom, pages in the usual order
+  continue with the error of the previous page. If a page starts above the
+  next row (e.g. the first page of the next frame), the error is cleared and
+  the rows in front of the page are processed again.
+
+*/
+
+#include "u8g.h"
+#include <string.h>
+
+static const uint8_t u8g_dither_bayer[16] = {
+    8, 136,  40, 168,
+  200,  72, 232, 104,
+   56, 184,  24, 152,
+  248, 120, 216,  88
+};
+
+void u8g_InitDither(u8g_dither_t *d, u8g_uint_t w, u8g_uint_t h, uint8_t format, uint8_t method, int16_t *err, u8g_dither_row_fn row_fn, void *ctx) {
+  d->row_fn = row_fn;
+  d->ctx = ctx;
+  d->err = err;
+  d->w = w;
+  d->h = h;
+  d->format = format;
+  d->method = method;
+  d->next_row = 0;
+  if (err != NULL)
+    memset(err, 0, ((size_t)w + 2) * sizeof(int16_t));
+}
+
+static uint8_t u8g_dither_get_levels(u8g_t *u8g) {
+  switch (u8g_GetMode(u8g)) {
+    case U8G_MODE_GRAY2BIT: return 3;
+    case U8G_MODE_GRAY4BIT: return 15;
+  }
+  return 1;
+}
+
+/* luminance of a R3G3B2 pixel, 0..255 */
+static uint8_t u8g_dither_get_gray(uint8_t format, uint8_t v) {
+  if (format == U8G_DITHER_R3G3B2)
+    return (uint8_t)(((uint16_t)(v >> 5) * 2806 + (uint16_t)((v >> 2) & 7) * 5464 + (uint16_t)(v & 3) * 2465) >> 8);
+  return v;
+}
+
+static void u8g_dither_flush(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t pixel) {
+  if (pixel != 0)
+    u8g_Draw8Pixel(u8g, x, y, 0, pixel);
+}
+
+/* dither one row, draw it only if is_draw is not 0 */
+static void u8g_dither_row(u8g_t *u8g, u8g_dither_t *d, u8g_uint_t x, u8g_uint_t y, u8g_uint_t r, uint8_t levels, uint8_t is_draw) {
+  const uint8_t *src = d->row_fn(d->ctx, r);
+  const uint8_t *bayer = u8g_dither_bayer + (r & 3) * 4;
+  int16_t *err = d->err;
+  int16_t v, e, right = 0, below_right = 0;
+  uint8_t level, pixel = 0;
+  u8g_uint_t i;
+
+  for ( i = 0; i < d->w; i++ ) {
+    v = u8g_dither_get_gray(d->format, src[i]);
+    if (d->method == U8G_DITHER_FLOYD_STEINBERG) {
+      v += right + err[i + 1];
+      if (v < 0)
+        level = 0;
+      else if (v > 255)
+        level = levels;
+      else
+        level = ((uint16_t)v * levels + 127) / 255;
+      e = v - (int16_t)((uint16_t)level * 255 / levels);
+      /* 7/16 right, 3/16 below left, 5/16 below, 1/16 below right */
+      err[i] += e * 3 / 16;
+      err[i + 1] = e * 5 / 16 + below_right;
+      below_right = e / 16;
+      right = e * 7 / 16;
+    }
+    else {
+      level = ((uint16_t)v * levels + bayer[i & 3]) >> 8;
+    }
+    if (is_draw == 0)
+      continue;
+    if (levels == 1) {
+      pixel <<= 1;
+      pixel |= level;
+      if ((i & 7) == 7) {
+        u8g_dither_flush(u8g, x + i - 7, y, pixel);
+        pixel = 0;
+      }
+    }
+    else if (level != 0) {
+      u8g_SetColorIndex(u8g, level);
+      u8g_DrawPixel(u8g, x + i, y);
+    }
+  }
+  if (is_draw && levels == 1 && (d->w & 7) != 0)
+    u8g_dither_flush(u8g, x + (d->w & ~7), y, pixel << (8 - (d->w & 7)));
+}
+
+void u8g_DrawDither(u8g_t *u8g, u8g_dither_t *d, u8g_uint_t x, u8g_uint_t y) {
+  u8g_uint_t r, r_first, r_last;
+  uint8_t levels, color;
+
+  if (d->w == 0 || d->h == 0)
+    return;
+  if (u8g_IsBBXIntersection(u8g, x, y, d->w, d->h) == 0)
+    return;
+
+  if (u8g_GetPageRows(u8g, y, d->h, &r_first, &r_last) == 0)
+    return;
+
+  levels = u8g_dither_get_levels(u8g);
+  color = u8g_GetColorIndex(u8g);
+  u8g_SetColorIndex(u8g, 1);
+
+  r = r_first;
+  if (d->method == U8G_DITHER_FLOYD_STEINBERG) {
+    if (r_first < d->next_row)
+      u8g_InitDither(d, d->w, d->h, d->format, d->method, d->err, d->row_fn, d->ctx);
+    for ( r = d->next_row; r < r_first; r++ )
+      u8g_dither_row(u8g, d, x, y + r, r, levels, 0);
+  }
+  for ( ;; ) {
+    u8g_dither_row(u8g, d, x, y + r, r, levels, 1);
+    if (r == r_last)
+      break;
+    r++;
+  }
+  d->next_row = r_last + 1;
+
+  u8g_SetColorIndex(u8g, color);
+}
@@ -95,43 +95,34 @@
 
 #endif // ifdef WORK_IN_PROGRESS
 
-#ifdef U8G_16BIT
-  typedef  int32_t u8g_long_t;
-#else
-  typedef  int16_t u8g_long_t;
-#endif
+// 32 bit also for 8 bit coordinates: rx*ry*ry exceeds 16 bit already for rx = ry = 32
+typedef int32_t u8g_long_t;
 
 /*
   Source:
     ftp://pc.fk0.name/pub/books/programming/bezier-ellipse.pdf
     Foley, Computer Graphics, p 90
-*/
-static void u8g_draw_ellipse_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) {
-  // upper right
-  if (option & U8G_DRAW_UPPER_RIGHT)
-    u8g_DrawPixel(u8g, x0 + x, y0 - y);
-
-  // upper left
-  if (option & U8G_DRAW_UPPER_LEFT)
-    u8g_DrawPixel(u8g, x0 - x, y0 - y);
-
-  // lower right
-  if (option & U8G_DRAW_LOWER_RIGHT)
-    u8g_DrawPixel(u8g, x0 + x, y0 + y);
-
-  // lower left
-  if (option & U8G_DRAW_LOWER_LEFT)
-    u8g_DrawPixel(u8g, x0 - x, y0 + y);
-}
 
+  Like circles (u8g_circle.c) ellipses are drawn as horizontal spans, only
+  rows inside the current page are drawn. The row extents are calculated
+  again for each page instead of being stored in a table, which would need
+  ry + 1 entries of RAM: rows outside of the page cost one step of the
+  error terms, but no drawing.
+  Region 1 starts at (rx, 0) with one point per row, region 2 starts at
+  (0, ry) with runs of points per row.
+*/
 void u8g_draw_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option) {
-  u8g_uint_t x, y;
+  u8g_uint_t x, y, xs;
   u8g_long_t xchg, ychg;
   u8g_long_t err;
   u8g_long_t rxrx2;
   u8g_long_t ryry2;
   u8g_long_t stopx, stopy;
 
+  option = u8g_cull_quadrants(u8g, x0, y0, rx, ry, option);
+  if (option == 0)
+    return;
+
   rxrx2 = rx;
   rxrx2 *= rx;
   rxrx2 *= 2;
@@ -159,7 +150,7 @@ void u8g_draw_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u
   stopy = 0;
 
   while (stopx >= stopy) {
-    u8g_draw_ellipse_section(u8g, x, y, x0, y0, option);
+    u8g_draw_quadrant_span(u8g, x0, y0, y, x, x, option);
     y++;
     stopy += rxrx2;
     err += ychg;
@@ -174,6 +165,7 @@ void u8g_draw_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u
 
   x = 0;
   y = ry;
+  xs = 0;
 
   xchg = ry;
   xchg *= ry;
@@ -192,19 +184,21 @@ void u8g_draw_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u
   stopy *= ry;
 
   while (stopx <= stopy) {
-    u8g_draw_ellipse_section(u8g, x, y, x0, y0, option);
     x++;
     stopx += ryry2;
     err += xchg;
     xchg += ryry2;
     if (2 * err + ychg > 0) {
+      u8g_draw_quadrant_span(u8g, x0, y0, y, xs, x - 1, option);
+      xs = x;
       y--;
       stopy -= rxrx2;
       err += ychg;
       ychg += rxrx2;
     }
   }
-
+  if (xs != x)
+    u8g_draw_quadrant_span(u8g, x0, y0, y, xs, x - 1, option);
 }
 
 void u8g_DrawEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option) {
@@ -230,31 +224,23 @@ void u8g_DrawEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8
   u8g_draw_ellipse(u8g, x0, y0, rx, ry, option);
 }
 
-static void u8g_draw_filled_ellipse_section(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t x0, u8g_uint_t y0, uint8_t option) {
-  // upper right
-  if (option & U8G_DRAW_UPPER_RIGHT)
-    u8g_DrawVLine(u8g, x0 + x, y0 - y, y + 1);
-
-  // upper left
-  if (option & U8G_DRAW_UPPER_LEFT)
-    u8g_DrawVLine(u8g, x0 - x, y0 - y, y + 1);
-
-  // lower right
-  if (option & U8G_DRAW_LOWER_RIGHT)
-    u8g_DrawVLine(u8g, x0 + x, y0, y + 1);
-
-  // lower left
-  if (option & U8G_DRAW_LOWER_LEFT)
-    u8g_DrawVLine(u8g, x0 - x, y0, y + 1);
-}
-
+/*
+  A row of the filled ellipse extends to the largest x of all points in this
+  and the outer rows. Region 2 is drawn first: afterwards its last point
+  (x2, y2) limits all rows below y2.
+*/
 void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option) {
-  u8g_uint_t x, y;
+  u8g_uint_t x, y, x2, y2;
   u8g_long_t xchg, ychg;
   u8g_long_t err;
   u8g_long_t rxrx2;
   u8g_long_t ryry2;
   u8g_long_t stopx, stopy;
+  uint8_t is_pending;
+
+  option = u8g_cull_quadrants(u8g, x0, y0, rx, ry, option);
+  if (option == 0)
+    return;
 
   rxrx2 = rx;
   rxrx2 *= rx;
@@ -264,37 +250,7 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
   ryry2 *= ry;
   ryry2 *= 2;
 
-  x = rx;
-  y = 0;
-
-  xchg = 1;
-  xchg -= rx;
-  xchg -= rx;
-  xchg *= ry;
-  xchg *= ry;
-
-  ychg = rx;
-  ychg *= rx;
-
-  err = 0;
-
-  stopx = ryry2;
-  stopx *= rx;
-  stopy = 0;
-
-  while (stopx >= stopy) {
-    u8g_draw_filled_ellipse_section(u8g, x, y, x0, y0, option);
-    y++;
-    stopy += rxrx2;
-    err += ychg;
-    ychg += rxrx2;
-    if (2 * err + xchg > 0) {
-      x--;
-      stopx -= ryry2;
-      err += xchg;
-      xchg += ryry2;
-    }
-  }
+  // region 2
 
   x = 0;
   y = ry;
@@ -315,20 +271,65 @@ void u8g_draw_filled_ellipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_
   stopy = rxrx2;
   stopy *= ry;
 
-  while (stopx <= stopy) {
-    u8g_draw_filled_ellipse_section(u8g, x, y, x0, y0, option);
+  do {
+    x2 = x;
+    y2 = y;
+    is_pending = 1;
     x++;
     stopx += ryry2;
     err += xchg;
     xchg += ryry2;
     if (2 * err + ychg > 0) {
+      u8g_draw_quadrant_span(u8g, x0, y0, y, 0, x2, option);
+      is_pending = 0;
       y--;
       stopy -= rxrx2;
       err += ychg;
       ychg += rxrx2;
     }
+  } while (stopx <= stopy);
+  if (is_pending)
+    u8g_draw_quadrant_span(u8g, x0, y0, y, 0, x2, option);
+
+  // region 1
+
+  x = rx;
+  y = 0;
+
+  xchg = 1;
+  xchg -= rx;
+  xchg -= rx;
+  xchg *= ry;
+  xchg *= ry;
+
+  ychg = rx;
+  ychg *= rx;
+
+  err = 0;
+
+  stopx = ryry2;
+  stopx *= rx;
+  stopy = 0;
+
+  while (stopx >= stopy) {
+    u8g_draw_quadrant_span(u8g, x0, y0, y, 0, y < y2 && x < x2 ? x2 : x, option);
+    y++;
+    stopy += rxrx2;
+    err += ychg;
+    ychg += rxrx2;
+    if (2 * err + xchg > 0) {
+      x--;
+      stopx -= ryry2;
+      err += xchg;
+      xchg += ryry2;
+    }
   }
 
+  // rows between both regions
+  while (y < y2) {
+    u8g_draw_quadrant_span(u8g, x0, y0, y, 0, x2, option);
+    y++;
+  }
 }
 
 void u8g_DrawFilledEllipse(u8g_t *u8g, u8g_uint_t x0, u8g_uint_t y0, u8g_uint_t rx, u8g_uint_t ry, uint8_t option) {
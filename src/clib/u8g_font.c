@@ -65,8 +65,36 @@ typedef void * u8g_glyph_t;
   15            font xascent
   16            font xdecent             negative: below baseline
 
+  font format 3: 16 bit encodings, sparse glyph ranges
+  offset
+  0..5          same as above
+  6             number of ranges (16 bit)
+  8             number of entries in the glyph index (16 bit)
+  10, 11        not used (0)
+  12..16        same as above
+  17            range table, sorted by encoding, 6 bytes per range:
+                  first encoding (16 bit), last encoding (16 bit), index of the first encoding (16 bit)
+                glyph index, 3 bytes per encoding of all ranges:
+                  offset of the glyph from the start of the font (24 bit), 0: no glyph
+                glyph data, same as format 0
+  All 16 bit and 24 bit values are stored msb first. A glyph is found with a binary search
+  in the range table and one index lookup. Strings are UTF-8 encoded for fonts of this format.
+
+  font format 4: run length encoded glyphs
+  offset
+  0..16         same as format 0
+  17            bits per run of background pixels (upper 4 bit), bits per run of foreground pixels (lower 4 bit), 1..7
+  18            first glyph, glyph information as format 0, data size is the size of the compressed data
+  The pixels of a glyph are read row by row as pairs of runs: m0 bits background pixels,
+  m1 bits foreground pixels, followed by one bit per repetition of the same pair and a 0 bit.
+  Runs continue on the next row. Bits are read lsb first. Rows outside of the current page
+  are not drawn, decoding stops after the last row inside the current page.
+
 */
 
+#define U8G_FONT_RANGE_SIZE 6
+#define U8G_FONT_INDEX_SIZE 3
+
 // use case: What is the width and the height of the minimal box into which string s fints?
 void u8g_font_GetStrSize(const void *font, const char *s, u8g_uint_t *width, u8g_uint_t *height);
 void u8g_font_GetStrSizeP(const void *font, const char *s, u8g_uint_t *width, u8g_uint_t *height);
@@ -98,6 +126,17 @@ static uint16_t u8g_font_get_word(const u8g_fntpgm_uint8_t *font, uint8_t offset
   return pos;
 }
 
+// 24 bit glyph offset of the format 3 glyph index
+static uint32_t u8g_font_get_offset(const u8g_fntpgm_uint8_t *idx) {
+  uint32_t offset;
+  offset = u8g_pgm_read((u8g_pgm_uint8_t *)idx);
+  offset <<= 8;
+  offset |= u8g_pgm_read((u8g_pgm_uint8_t *)idx + 1);
+  offset <<= 8;
+  offset |= u8g_pgm_read((u8g_pgm_uint8_t *)idx + 2);
+  return offset;
+}
+
 //========================================================================
 // direct access on the font
 
@@ -110,10 +149,19 @@ static uint8_t u8g_font_GetFontGlyphStructureSize(const u8g_fntpgm_uint8_t *font
     case 0: return 6;
     case 1: return 3;
     case 2: return 6;
+    case 3: return 6;
+    case 4: return 6;
   }
   return 3;
 }
 
+// size of the font information in front of the first glyph (formats 0, 1, 2 and 4)
+static uint8_t u8g_font_GetFontHeaderSize(const u8g_fntpgm_uint8_t *font) {
+  if (u8g_font_GetFormat(font) == 4)
+    return U8G_FONT_DATA_STRUCT_SIZE + 1;
+  return U8G_FONT_DATA_STRUCT_SIZE;
+}
+
 static uint8_t u8g_font_GetBBXWidth(const void *font) {
   return u8g_font_get_byte(font, 1);
 }
@@ -184,13 +232,31 @@ size_t u8g_font_GetSize(const void *font) {
   uint8_t i;
   uint8_t mask = 255;
 
+  if (font_format == 3) {
+    // the glyph with the highest offset is the last one of the font
+    const u8g_fntpgm_uint8_t *idx = (const u8g_fntpgm_uint8_t *)font;
+    uint16_t cnt = u8g_font_get_word(font, 8);
+    uint32_t offset, last = 0;
+    idx += U8G_FONT_DATA_STRUCT_SIZE + (uint32_t)u8g_font_get_word(font, 6) * U8G_FONT_RANGE_SIZE;
+    for ( ; cnt > 0; cnt-- ) {
+      offset = u8g_font_get_offset(idx);
+      if (last < offset)
+        last = offset;
+      idx += U8G_FONT_INDEX_SIZE;
+    }
+    if (last == 0)
+      return idx - (const u8g_fntpgm_uint8_t *)font;
+    p += last;
+    return p + data_structure_size + u8g_pgm_read(((u8g_pgm_uint8_t *)(p)) + 2 ) - (uint8_t *)font;
+  }
+
   start = u8g_font_GetFontStartEncoding(font);
   end = u8g_font_GetFontEndEncoding(font);
 
   if (font_format == 1)
     mask = 15;
 
-  p += U8G_FONT_DATA_STRUCT_SIZE;       // skip font general information
+  p += u8g_font_GetFontHeaderSize(font);       // skip font general information
 
   i = start;
   for (;;) {
@@ -240,6 +306,8 @@ static void u8g_CopyGlyphDataToCache(u8g_t *u8g, u8g_glyph_t g) {
   switch (u8g_font_GetFormat(u8g->font)) {
     case 0:
     case 2:
+    case 3:
+    case 4:
       /*
         format 0
         glyph information
@@ -298,6 +366,42 @@ static void u8g_FillEmptyGlyphCache(u8g_t *u8g) {
   u8g->glyph_y = 0;
 }
 
+/*
+  Format 3: binary search for the range of the encoding, then one lookup in the glyph index
+*/
+static u8g_glyph_t u8g_font_find_glyph16(u8g_t *u8g, uint16_t requested_encoding) {
+  const u8g_fntpgm_uint8_t *font = (const u8g_fntpgm_uint8_t *)(u8g->font);
+  const u8g_fntpgm_uint8_t *range;
+  uint16_t lo, hi, mid;
+  uint32_t offset;
+
+  lo = 0;
+  hi = u8g_font_get_word(font, 6);
+  while (lo < hi) {
+    mid = lo + (hi - lo) / 2;
+    range = font + U8G_FONT_DATA_STRUCT_SIZE + (uint32_t)mid * U8G_FONT_RANGE_SIZE;
+    if (requested_encoding < u8g_font_get_word(range, 0)) {
+      hi = mid;
+    }
+    else if (requested_encoding > u8g_font_get_word(range, 2)) {
+      lo = mid + 1;
+    }
+    else {
+      offset = u8g_font_get_word(range, 4);
+      offset += requested_encoding - u8g_font_get_word(range, 0);
+      offset *= U8G_FONT_INDEX_SIZE;
+      offset += U8G_FONT_DATA_STRUCT_SIZE + (uint32_t)u8g_font_get_word(font, 6) * U8G_FONT_RANGE_SIZE;
+      offset = u8g_font_get_offset(font + offset);
+      if (offset == 0)
+        break;
+      u8g_CopyGlyphDataToCache(u8g, (u8g_glyph_t)(font + offset));
+      return (u8g_glyph_t)(font + offset);
+    }
+  }
+  u8g_FillEmptyGlyphCache(u8g);
+  return NULL;
+}
+
 /*
   Find (with some speed optimization) and return a pointer to the glyph data structure
   Also uncompress (format 1) and copy the content of the data structure to the u8g structure
@@ -311,6 +415,9 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding) {
   uint8_t i;
   uint8_t mask = 255;
 
+  if (font_format == 3)
+    return u8g_font_find_glyph16(u8g, requested_encoding);
+
   if (font_format == 1)
     mask = 15;
 
@@ -329,7 +436,7 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding) {
       start = 65;
     }
     else {
-      p += U8G_FONT_DATA_STRUCT_SIZE;       // skip font general information
+      p += u8g_font_GetFontHeaderSize(u8g->font);       // skip font general information
     }
   }
 
@@ -363,6 +470,22 @@ u8g_glyph_t u8g_GetGlyph(u8g_t *u8g, uint8_t requested_encoding) {
   return NULL;
 }
 
+// 16 bit encodings are available with font format 3, all other formats have 8 bit encodings only
+u8g_glyph_t u8g_GetGlyph16(u8g_t *u8g, uint16_t requested_encoding) {
+  if (u8g_font_GetFormat(u8g->font) == 3)
+    return u8g_font_find_glyph16(u8g, requested_encoding);
+  if (requested_encoding < 256)
+    return u8g_GetGlyph(u8g, requested_encoding);
+  u8g_FillEmptyGlyphCache(u8g);
+  return NULL;
+}
+
+uint8_t u8g_IsGlyph16(u8g_t *u8g, uint16_t requested_encoding) {
+  if (u8g_GetGlyph16(u8g, requested_encoding) != NULL)
+    return 1;
+  return 0;
+}
+
 uint8_t u8g_IsGlyph(u8g_t *u8g, uint8_t requested_encoding) {
   if (u8g_GetGlyph(u8g, requested_encoding) != NULL)
     return 1;
@@ -494,14 +617,131 @@ int8_t u8g_GetGlyphDeltaX(u8g_t *u8g, uint8_t requested_encoding) {
   }
 #endif // ifdef OBSOLETE
 
+//========================================================================
+// run length encoded glyphs (format 4)
+
+struct _u8g_font_rle_t {
+  const u8g_pgm_uint8_t *data;
+  uint8_t bits;             // not yet used bits of the current byte, lsb first
+  uint8_t cnt;              // number of bits in "bits"
+};
+typedef struct _u8g_font_rle_t u8g_font_rle_t;
+
+// read n (1..8) bits
+static uint8_t u8g_font_rle_get(u8g_font_rle_t *rle, uint8_t n) {
+  uint8_t v = rle->bits;
+  if (rle->cnt >= n) {
+    rle->bits >>= n;
+    rle->cnt -= n;
+  }
+  else {
+    uint8_t next = u8g_pgm_read(rle->data);
+    rle->data++;
+    v |= next << rle->cnt;
+    rle->bits = next >> (n - rle->cnt);
+    rle->cnt += 8 - n;
+  }
+  return v & ((1 << n) - 1);
+}
+
+/*
+  Draw a run of foreground pixels: row r, column c, length n (glyph coordinates)
+  base: position of row 0 (x for dir 1 and 3, y for dir 0 and 2), pos: position of column 0
+*/
+static void u8g_font_rle_span(u8g_t *u8g, uint8_t dir, u8g_uint_t base, u8g_uint_t pos, uint8_t r, uint8_t c, uint8_t n) {
+  switch (dir) {
+    case 0: u8g_draw_hline(u8g, pos + c, base + r, n); break;
+    case 1: u8g_draw_vline(u8g, base - r, pos + c, n); break;
+    case 2: u8g_draw_hline(u8g, pos - c - n + 1, base - r, n); break;
+    case 3: u8g_draw_vline(u8g, base + r, pos - c - n + 1, n); break;
+  }
+}
+
+/*
+  Decode and draw the glyph in u8g->glyph_xxx with data at "data".
+  Only the rows inside the current page are drawn, decoding stops after the last of them.
+*/
+static void u8g_font_draw_rle(u8g_t *u8g, uint8_t dir, u8g_uint_t base, u8g_uint_t pos, const u8g_pgm_uint8_t *data) {
+  u8g_font_rle_t rle;
+  uint8_t w = u8g->glyph_width;
+  uint8_t h = u8g->glyph_height;
+  uint8_t m0, m1;
+  uint8_t r, c, a, b, n, len;
+  u8g_uint_t r_first, r_last;
+
+  if (w == 0 || h == 0)
+    return;
+
+  // rows of the glyph inside the current page
+  if (dir == 0 || dir == 2) {
+    r_first = dir == 0 ? u8g->current_page.y0 - base : base - u8g->current_page.y1;
+    r_last = dir == 0 ? u8g->current_page.y1 - base : base - u8g->current_page.y0;
+  }
+  else {
+    r_first = dir == 3 ? u8g->current_page.x0 - base : base - u8g->current_page.x1;
+    r_last = dir == 3 ? u8g->current_page.x1 - base : base - u8g->current_page.x0;
+  }
+  if (r_first > r_last)
+    r_first = 0;              // the glyph starts inside the page
+  if (r_last >= h)
+    r_last = h - 1;
+
+  m0 = u8g_font_get_byte(u8g->font, U8G_FONT_DATA_STRUCT_SIZE);
+  m1 = m0 & 15;
+  m0 >>= 4;
+
+  rle.data = data;
+  rle.cnt = 0;
+  rle.bits = 0;
+  r = 0;
+  c = 0;
+  for (;;) {
+    a = u8g_font_rle_get(&rle, m0);
+    b = u8g_font_rle_get(&rle, m1);
+    do {
+      // background
+      n = a;
+      while (n >= w - c) {
+        n -= w - c;
+        c = 0;
+        r++;
+      }
+      c += n;
+      // foreground, split at the end of the row
+      n = b;
+      while (n > 0) {
+        if (r > r_last)
+          return;
+        len = w - c;
+        if (len > n)
+          len = n;
+        if (r >= r_first)
+          u8g_font_rle_span(u8g, dir, base, pos, r, c, len);
+        n -= len;
+        c += len;
+        if (c == w) {
+          c = 0;
+          r++;
+        }
+      }
+      if (r > r_last)
+        return;
+    } while (u8g_font_rle_get(&rle, 1));
+  }
+}
+
 int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding) {
+  return u8g_draw_glyph16(u8g, x, y, encoding);
+}
+
+int8_t u8g_draw_glyph16(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding) {
   const u8g_pgm_uint8_t *data;
   uint8_t w, h;
   uint8_t i, j;
   u8g_uint_t ix, iy;
 
   {
-    u8g_glyph_t g = u8g_GetGlyph(u8g, encoding);
+    u8g_glyph_t g = u8g_GetGlyph16(u8g, encoding);
     if (g == NULL)
       return 0;
     data = u8g_font_GetGlyphDataStart(u8g->font, g);
@@ -517,6 +757,11 @@ int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
   if (u8g_IsBBXIntersection(u8g, x, y - h + 1, w, h) == 0)
     return u8g->glyph_dx;
 
+  if (u8g_font_GetFormat(u8g->font) == 4) {
+    u8g_font_draw_rle(u8g, 0, y - h + 1, x, data);
+    return u8g->glyph_dx;
+  }
+
   // now, w is reused as bytes per line
   w += 7;
   w /= 8;
@@ -525,6 +770,11 @@ int8_t u8g_draw_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
   iy -= h;
   iy++;
 
+  if (u8g->dev_caps & U8G_DEV_CAP_8X8PIXEL) {
+    u8g_draw_bitmap_rows(u8g, x, iy, w, h, (const uint8_t *)data, 1);
+    return u8g->glyph_dx;
+  }
+
   for ( j = 0; j < h; j++ ) {
     ix = x;
     for ( i = 0; i < w; i++ ) {
@@ -542,14 +792,19 @@ int8_t u8g_DrawGlyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding) {
   return u8g_draw_glyph(u8g, x, y, encoding);
 }
 
-int8_t u8g_draw_glyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding) {
+int8_t u8g_DrawGlyph16(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding) {
+  y += u8g->font_calc_vref(u8g);
+  return u8g_draw_glyph16(u8g, x, y, encoding);
+}
+
+int8_t u8g_draw_glyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding) {
   const u8g_pgm_uint8_t *data;
   uint8_t w, h;
   uint8_t i, j;
   u8g_uint_t ix, iy;
 
   {
-    u8g_glyph_t g = u8g_GetGlyph(u8g, encoding);
+    u8g_glyph_t g = u8g_GetGlyph16(u8g, encoding);
     if (g == NULL)
       return 0;
     data = u8g_font_GetGlyphDataStart(u8g->font, g);
@@ -565,6 +820,11 @@ int8_t u8g_draw_glyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding
   if (u8g_IsBBXIntersection(u8g, x, y, h, w) == 0)
     return u8g->glyph_dx;
 
+  if (u8g_font_GetFormat(u8g->font) == 4) {
+    u8g_font_draw_rle(u8g, 1, x + h - 1, y, data);
+    return u8g->glyph_dx;
+  }
+
   // now, w is reused as bytes per line
   w += 7;
   w /= 8;
@@ -589,14 +849,14 @@ int8_t u8g_DrawGlyph90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding)
   return u8g_draw_glyph90(u8g, x, y, encoding);
 }
 
-int8_t u8g_draw_glyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding) {
+int8_t u8g_draw_glyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding) {
   const u8g_pgm_uint8_t *data;
   uint8_t w, h;
   uint8_t i, j;
   u8g_uint_t ix, iy;
 
   {
-    u8g_glyph_t g = u8g_GetGlyph(u8g, encoding);
+    u8g_glyph_t g = u8g_GetGlyph16(u8g, encoding);
     if (g == NULL)
       return 0;
     data = u8g_font_GetGlyphDataStart(u8g->font, g);
@@ -612,6 +872,11 @@ int8_t u8g_draw_glyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   if (u8g_IsBBXIntersection(u8g, x - (w - 1), y, w, h) == 0)
     return u8g->glyph_dx;
 
+  if (u8g_font_GetFormat(u8g->font) == 4) {
+    u8g_font_draw_rle(u8g, 2, y + h - 1, x, data);
+    return u8g->glyph_dx;
+  }
+
   // now, w is reused as bytes per line
   w += 7;
   w /= 8;
@@ -636,14 +901,14 @@ int8_t u8g_DrawGlyph180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding
   return u8g_draw_glyph180(u8g, x, y, encoding);
 }
 
-int8_t u8g_draw_glyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding) {
+int8_t u8g_draw_glyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint16_t encoding) {
   const u8g_pgm_uint8_t *data;
   uint8_t w, h;
   uint8_t i, j;
   u8g_uint_t ix, iy;
 
   {
-    u8g_glyph_t g = u8g_GetGlyph(u8g, encoding);
+    u8g_glyph_t g = u8g_GetGlyph16(u8g, encoding);
     if (g == NULL)
       return 0;
     data = u8g_font_GetGlyphDataStart(u8g->font, g);
@@ -659,6 +924,11 @@ int8_t u8g_draw_glyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   if (u8g_IsBBXIntersection(u8g, x - (h - 1), y - (w - 1), h, w) == 0)
     return u8g->glyph_dx;
 
+  if (u8g_font_GetFormat(u8g->font) == 4) {
+    u8g_font_draw_rle(u8g, 3, x - h + 1, y, data);
+    return u8g->glyph_dx;
+  }
+
   // now, w is reused as bytes per line
   w += 7;
   w /= 8;
@@ -697,23 +967,93 @@ int8_t u8g_DrawGlyph270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encoding
   }
 #endif
 
+//========================================================================
+// string access
+
+char u8g_font_get_char(const void *s) {
+  return *(const char *)(s);
+}
+
+char u8g_font_get_charP(const void *s) {
+  return u8g_pgm_read(s);
+}
+
+/*
+  Return the encoding of the next char and advance s, 0 at the end of the string (s is not advanced).
+  Strings are UTF-8 for fonts with 16 bit encodings (format 3), one byte per char otherwise.
+  Invalid sequences return U8G_ENCODING_INVALID, never 0: a continuation byte without a
+  start byte, an incomplete sequence, an overlong form (e.g. C0 80 for 0), a surrogate
+  (D800..DFFF) and all code points above 0xffff. A byte which can not continue the
+  sequence is not consumed, it starts the next char.
+*/
+uint16_t u8g_font_next_encoding(u8g_t *u8g, const char **s, u8g_font_get_char_fn get_char) {
+  uint8_t c, lead, n;
+  uint16_t encoding;
+
+  lead = get_char(*s);
+  if (lead == '\0')
+    return 0;
+  (*s)++;
+  if (lead < 0x080 || u8g_font_GetFormat(u8g->font) != 3)
+    return lead;
+
+  if (lead >= 0x0f8)
+    return U8G_ENCODING_INVALID;      // not a start byte
+  else if (lead >= 0x0f0)
+    n = 3;
+  else if (lead >= 0x0e0)
+    n = 2;
+  else if (lead >= 0x0c0)
+    n = 1;
+  else
+    return U8G_ENCODING_INVALID;      // continuation byte without a start byte
+
+  encoding = lead & (0x03f >> n);
+  do {
+    c = get_char(*s);
+    if ((c & 0x0c0) != 0x080)
+      return U8G_ENCODING_INVALID;    // also stops at the end of the string
+    encoding <<= 6;
+    encoding |= c & 0x03f;
+    (*s)++;
+    n--;
+  } while (n > 0);
+
+  if (lead >= 0x0f0)
+    return U8G_ENCODING_INVALID;      // outside of the 16 bit range
+  if (lead < 0x0e0) {
+    if (encoding < 0x080)
+      return U8G_ENCODING_INVALID;    // overlong, two bytes
+  }
+  else if (encoding < 0x0800 || (encoding >= 0x0d800 && encoding <= 0x0dfff)) {
+    return U8G_ENCODING_INVALID;      // overlong or surrogate, three bytes
+  }
+  return encoding;
+}
+
 //========================================================================
 // string drawing procedures
 
 u8g_uint_t u8g_DrawStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s) {
   u8g_uint_t t = 0;
   int8_t d;
+  uint16_t encoding;
 
   // u8g_uint_t u8g_GetStrWidth(u8g, s);
   // u8g_font_GetFontAscent(u8g->font)-u8g_font_GetFontDescent(u8g->font);
 
   y += u8g->font_calc_vref(u8g);
 
-  while (*s != '\0') {
-    d = u8g_draw_glyph(u8g, x, y, *s);
+  if (u8g->str_cache != NULL && u8g_draw_str_cached(u8g, x, y, s, &t))
+    return t;
+
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    d = u8g_draw_glyph16(u8g, x, y, encoding);
     x += d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -721,14 +1061,17 @@ u8g_uint_t u8g_DrawStr(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s) {
 u8g_uint_t u8g_DrawStr90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s) {
   u8g_uint_t t = 0;
   int8_t d;
+  uint16_t encoding;
 
   x -= u8g->font_calc_vref(u8g);
 
-  while (*s != '\0') {
-    d = u8g_draw_glyph90(u8g, x, y, *s);
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    d = u8g_draw_glyph90(u8g, x, y, encoding);
     y += d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -736,14 +1079,17 @@ u8g_uint_t u8g_DrawStr90(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
 u8g_uint_t u8g_DrawStr180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s) {
   u8g_uint_t t = 0;
   int8_t d;
+  uint16_t encoding;
 
   y -= u8g->font_calc_vref(u8g);
 
-  while (*s != '\0') {
-    d = u8g_draw_glyph180(u8g, x, y, *s);
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    d = u8g_draw_glyph180(u8g, x, y, encoding);
     x -= d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -751,14 +1097,17 @@ u8g_uint_t u8g_DrawStr180(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s)
 u8g_uint_t u8g_DrawStr270(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s) {
   u8g_uint_t t = 0;
   int8_t d;
+  uint16_t encoding;
 
   x += u8g->font_calc_vref(u8g);
 
-  while (*s != '\0') {
-    d = u8g_draw_glyph270(u8g, x, y, *s);
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    d = u8g_draw_glyph270(u8g, x, y, encoding);
     y -= d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -780,18 +1129,17 @@ u8g_uint_t u8g_DrawStrDir(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, c
 u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s) {
   u8g_uint_t t = 0;
   int8_t d;
-  uint8_t c;
+  uint16_t encoding;
 
   y += u8g->font_calc_vref(u8g);
 
   for (;;) {
-    c = u8g_pgm_read(s);
-    if (c == '\0')
+    encoding = u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP);
+    if (encoding == 0)
       break;
-    d = u8g_draw_glyph(u8g, x, y, c);
+    d = u8g_draw_glyph16(u8g, x, y, encoding);
     x += d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -799,18 +1147,17 @@ u8g_uint_t u8g_DrawStrP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_ui
 u8g_uint_t u8g_DrawStr90P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s) {
   u8g_uint_t t = 0;
   int8_t d;
-  uint8_t c;
+  uint16_t encoding;
 
   x -= u8g->font_calc_vref(u8g);
 
   for (;;) {
-    c = u8g_pgm_read(s);
-    if (c == '\0')
+    encoding = u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP);
+    if (encoding == 0)
       break;
-    d = u8g_DrawGlyph90(u8g, x, y, c);
+    d = u8g_draw_glyph90(u8g, x, y, encoding);
     y += d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -818,18 +1165,17 @@ u8g_uint_t u8g_DrawStr90P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_
 u8g_uint_t u8g_DrawStr180P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s) {
   u8g_uint_t t = 0;
   int8_t d;
-  uint8_t c;
+  uint16_t encoding;
 
   y -= u8g->font_calc_vref(u8g);
 
   for (;;) {
-    c = u8g_pgm_read(s);
-    if (c == '\0')
+    encoding = u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP);
+    if (encoding == 0)
       break;
-    d = u8g_DrawGlyph180(u8g, x, y, c);
+    d = u8g_draw_glyph180(u8g, x, y, encoding);
     x -= d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -837,18 +1183,17 @@ u8g_uint_t u8g_DrawStr180P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm
 u8g_uint_t u8g_DrawStr270P(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *s) {
   u8g_uint_t t = 0;
   int8_t d;
-  uint8_t c;
+  uint16_t encoding;
 
   x += u8g->font_calc_vref(u8g);
 
   for (;;) {
-    c = u8g_pgm_read(s);
-    if (c == '\0')
+    encoding = u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP);
+    if (encoding == 0)
       break;
-    d = u8g_DrawGlyph270(u8g, x, y, c);
+    d = u8g_draw_glyph270(u8g, x, y, encoding);
     y -= d;
     t += d;
-    s++;
   }
   return t;
 }
@@ -861,6 +1206,7 @@ u8g_uint_t u8g_DrawStrFontBBX(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t di
 
 // still used by picgen.c, dir argument is ignored
 int8_t u8g_DrawGlyphFontBBX(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t encoding) {
+  (void)dir;
   x -= u8g_GetFontBBXOffX(u8g);
   y += u8g_GetFontBBXOffY(u8g);
   u8g_draw_glyph(u8g, x, y, encoding);
@@ -921,6 +1267,7 @@ void u8g_SetFontLineSpacingFactor(u8g_t *u8g, uint8_t factor) {
 // callback procedures to correct the y position
 
 u8g_uint_t u8g_font_calc_vref_font(u8g_t *u8g) {
+  (void)u8g;
   return 0;
 }
 
@@ -971,24 +1318,14 @@ void u8g_SetFontPosCenter(u8g_t *u8g) {
 //========================================================================
 // string pixel width calculation
 
-char u8g_font_get_char(const void *s) {
-  return *(const char *)(s);
-}
-
-char u8g_font_get_charP(const void *s) {
-  return u8g_pgm_read(s);
-}
-
-typedef char (*u8g_font_get_char_fn)(const void *s);
-
 u8g_uint_t u8g_font_calc_str_pixel_width(u8g_t *u8g, const char *s, u8g_font_get_char_fn get_char ) {
   u8g_uint_t w;
-  uint8_t enc;
+  uint16_t enc, next;
 
   // reset the total minimal width to zero, this will be expanded during calculation
   w = 0;
 
-  enc = get_char(s);
+  enc = u8g_font_next_encoding(u8g, &s, get_char);
 
   // check for empty string, width is already 0
   if (enc == '\0')
@@ -996,7 +1333,7 @@ u8g_uint_t u8g_font_calc_str_pixel_width(u8g_t *u8g, const char *s, u8g_font_get
 
   // get the glyph information of the first char. This must be valid, because we already checked for the empty string
   // if *s is not inside the font, then the cached parameters of the glyph are all zero
-  u8g_GetGlyph(u8g, enc);
+  u8g_GetGlyph16(u8g, enc);
 
   // strlen(s) == 1:       width = width(s[0])
   // strlen(s) == 2:       width = - offx(s[0]) + deltax(s[0]) + offx(s[1]) + width(s[1])
@@ -1008,18 +1345,18 @@ u8g_uint_t u8g_font_calc_str_pixel_width(u8g_t *u8g, const char *s, u8g_font_get
   for (;;) {
 
     // check and stop if the end of the string is reached
-    s++;
-    if (get_char(s) == '\0')
+    next = u8g_font_next_encoding(u8g, &s, get_char);
+    if (next == '\0')
       break;
 
     // if there are still more characters, add the delta to the next glyph
     w += u8g->glyph_dx;
 
     // store the encoding in a local variable, used also after the for(;;) loop
-    enc = get_char(s);
+    enc = next;
 
     // load the next glyph information
-    u8g_GetGlyph(u8g, enc);
+    u8g_GetGlyph16(u8g, enc);
   }
 
   // finally calculate the width of the last char
@@ -1045,12 +1382,12 @@ u8g_uint_t u8g_GetStrPixelWidthP(u8g_t *u8g, const u8g_pgm_uint8_t *s) {
 }
 
 int8_t u8g_GetStrX(u8g_t *u8g, const char *s) {
-  u8g_GetGlyph(u8g, *s);
+  u8g_GetGlyph16(u8g, u8g_font_next_encoding(u8g, &s, u8g_font_get_char));
   return u8g->glyph_x;
 }
 
 int8_t u8g_GetStrXP(u8g_t *u8g, const u8g_pgm_uint8_t *s) {
-  u8g_GetGlyph(u8g, u8g_pgm_read(s));
+  u8g_GetGlyph16(u8g, u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP));
   return u8g->glyph_x;
 }
 
@@ -1059,22 +1396,19 @@ int8_t u8g_GetStrXP(u8g_t *u8g, const u8g_pgm_uint8_t *s) {
 
 u8g_uint_t u8g_GetStrWidth(u8g_t *u8g, const char *s) {
   u8g_uint_t w;
-  uint8_t encoding;
+  uint16_t encoding;
 
   // reset the total width to zero, this will be expanded during calculation
   w = 0;
 
   for (;;) {
-    encoding = *s;
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
     if (encoding == 0)
       break;
 
     // load glyph information
-    u8g_GetGlyph(u8g, encoding);
+    u8g_GetGlyph16(u8g, encoding);
     w += u8g->glyph_dx;
-
-    // goto next char
-    s++;
   }
 
   return w;
@@ -1082,22 +1416,19 @@ u8g_uint_t u8g_GetStrWidth(u8g_t *u8g, const char *s) {
 
 u8g_uint_t u8g_GetStrWidthP(u8g_t *u8g, const u8g_pgm_uint8_t *s) {
   u8g_uint_t w;
-  uint8_t encoding;
+  uint16_t encoding;
 
   // reset the total width to zero, this will be expanded during calculation
   w = 0;
 
   for (;;) {
-    encoding = u8g_pgm_read(s);
+    encoding = u8g_font_next_encoding(u8g, (const char **)&s, u8g_font_get_charP);
     if (encoding == 0)
       break;
 
     // load glyph information
-    u8g_GetGlyph(u8g, encoding);
+    u8g_GetGlyph16(u8g, encoding);
     w += u8g->glyph_dx;
-
-    // goto next char
-    s++;
   }
 
   return w;
@@ -1125,6 +1456,7 @@ typedef struct u8g_str_size_struct u8g_str_size_t;
 static void u8g_font_calc_str_min_box(u8g_t *u8g, const char *s, u8g_str_size_t *buf) {
   // u8g_glyph_t g;
   int8_t tmp;
+  uint16_t encoding;
 
   // reset the total minimal width to zero, this will be expanded during calculation
   buf->w = 0;
@@ -1146,7 +1478,7 @@ static void u8g_font_calc_str_min_box(u8g_t *u8g, const char *s, u8g_str_size_t
   buf->y_max = -128;
 
   // get the glyph information of the first char. This must be valid, because we already checked for the empty string
-  u8g_GetGlyph(u8g, *s);
+  u8g_GetGlyph16(u8g, u8g_font_next_encoding(u8g, &s, u8g_font_get_char));
 
   // strlen(s) == 1:       width = width(s[0])
   // strlen(s) == 2:       width = - offx(s[0]) + deltax(s[0]) + offx(s[1]) + width(s[1])
@@ -1175,15 +1507,15 @@ static void u8g_font_calc_str_min_box(u8g_t *u8g, const char *s, u8g_str_size_t
       buf->y_max = tmp;
 
     // check and stop if the end of the string is reached
-    s++;
-    if (*s == '\0')
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == '\0')
       break;
 
     // if there are still more characters, add the delta to the next glyph
     buf->w += u8g->glyph_dx;
 
     // load the next glyph information
-    u8g_GetGlyph(u8g, *s);
+    u8g_GetGlyph16(u8g, encoding);
   }
 
   // finally calculate the width of the last char
@@ -1201,12 +1533,16 @@ void u8g_font_box_min(u8g_t *u8g, const char *s, u8g_str_size_t *buf) {
 
 // calculate gA box, but do not calculate the overall width
 void u8g_font_box_left_gA(u8g_t *u8g, const char *s, u8g_str_size_t *buf) {
-
+  (void)u8g;
+  (void)s;
+  (void)buf;
 }
 
 // calculate gA box, including overall width
 void u8g_font_box_all_gA(u8g_t *u8g, const char *s, u8g_str_size_t *buf) {
-
+  (void)u8g;
+  (void)s;
+  (void)buf;
 }
 
 static void u8g_font_get_str_box_fill_args(u8g_t *u8g, const char *s, u8g_str_size_t *buf, u8g_uint_t *x, u8g_uint_t *y, u8g_uint_t *width, u8g_uint_t *height) {
@@ -1214,7 +1550,7 @@ static void u8g_font_get_str_box_fill_args(u8g_t *u8g, const char *s, u8g_str_si
   u8g_glyph_t g;
   g =
   */
-  u8g_GetGlyph(u8g, *s);
+  u8g_GetGlyph16(u8g, u8g_font_next_encoding(u8g, &s, u8g_font_get_char));
   *x += u8g->glyph_x;
   *width = buf->w;
   *y -= buf->y_max;
@@ -1271,10 +1607,12 @@ int8_t u8g_draw_aa_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   const u8g_pgm_uint8_t *data;
   uint8_t w, h;
   uint8_t i, j;
+  uint8_t pixel;
   u8g_uint_t ix, iy;
+  u8g_uint_t r_first, r_last;
 
   {
-    u8g_glyph_t g = u8g_GetGlyph(u8g, encoding);
+    u8g_glyph_t g = u8g_GetGlyph16(u8g, encoding);
     if (g == NULL)
       return 0;
     data = u8g_font_GetGlyphDataStart(u8g->font, g);
@@ -1287,6 +1625,8 @@ int8_t u8g_draw_aa_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   y -= u8g->glyph_y;
   y--;
 
+  if (w == 0 || h == 0)
+    return u8g->glyph_dx;
   if (u8g_IsBBXIntersection(u8g, x, y - h + 1, w, h) == 0)
     return u8g->glyph_dx;
 
@@ -1298,10 +1638,18 @@ int8_t u8g_draw_aa_glyph(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t encodin
   iy -= h;
   iy++;
 
-  for ( j = 0; j < h; j++ ) {
+  // rows of the glyph inside the current page, 4 transparent pixel are skipped
+  if (u8g_GetPageRows(u8g, iy, h, &r_first, &r_last) == 0)
+    return u8g->glyph_dx;
+  data += r_first * w;
+  iy += r_first;
+
+  for ( j = r_first; j <= r_last; j++ ) {
     ix = x;
     for ( i = 0; i < w; i++ ) {
-      u8g_Draw4TPixel(u8g, ix, iy, 0, u8g_pgm_read(data));
+      pixel = u8g_pgm_read(data);
+      if (pixel != 0)
+        u8g_Draw4TPixel(u8g, ix, iy, 0, pixel);
       data++;
       ix += 4;
     }
@@ -1656,6 +1656,216 @@ const u8g_fntpgm_uint8_t u8g_font_6x10r[889] U8G_FONT_SECTION("u8g_font_6x10r")
   32, 192, 6, 83, 99, 72, 168, 144, 255
 };
 
+/*
+  u8g_font_6x10 with 16 bit encodings (format 3): ISO 8859-1 and the glyphs of
+  extras/u8g_font_sample.bdf (Cyrillic, CJK and U+FFFD), built with
+  extras/u8g_font_range.c. Strings are UTF-8.
+*/
+const u8g_fntpgm_uint8_t u8g_font_6x10_utf8[3224] U8G_FONT_SECTION("u8g_font_6x10_utf8") = {
+  3, 9, 10, 0, 254, 7, 0, 11, 0, 202, 0, 0, 254, 8, 254, 7,
+  254, 0, 32, 0, 126, 0, 0, 0, 160, 0, 255, 0, 95, 4, 31, 4,
+  31, 0, 191, 4, 50, 4, 50, 0, 192, 4, 53, 4, 53, 0, 193, 4,
+  56, 4, 56, 0, 194, 4, 60, 4, 60, 0, 195, 4, 64, 4, 66, 0,
+  196, 78, 45, 78, 45, 0, 199, 101, 135, 101, 135, 0, 200, 255, 253, 255,
+  253, 0, 201, 0, 2, 177, 0, 2, 183, 0, 2, 196, 0, 2, 205, 0,
+  2, 218, 0, 2, 231, 0, 2, 244, 0, 3, 1, 0, 3, 10, 0, 3,
+  23, 0, 3, 36, 0, 3, 47, 0, 3, 58, 0, 3, 67, 0, 3, 74,
+  0, 3, 83, 0, 3, 96, 0, 3, 109, 0, 3, 122, 0, 3, 135, 0,
+  3, 148, 0, 3, 161, 0, 3, 174, 0, 3, 187, 0, 3, 200, 0, 3,
+  213, 0, 3, 226, 0, 3, 239, 0, 3, 252, 0, 4, 9, 0, 4, 18,
+  0, 4, 31, 0, 4, 44, 0, 4, 57, 0, 4, 70, 0, 4, 83, 0,
+  4, 96, 0, 4, 109, 0, 4, 122, 0, 4, 135, 0, 4, 148, 0, 4,
+  161, 0, 4, 174, 0, 4, 187, 0, 4, 200, 0, 4, 213, 0, 4, 226,
+  0, 4, 239, 0, 4, 252, 0, 5, 9, 0, 5, 23, 0, 5, 36, 0,
+  5, 49, 0, 5, 62, 0, 5, 75, 0, 5, 88, 0, 5, 101, 0, 5,
+  114, 0, 5, 127, 0, 5, 140, 0, 5, 153, 0, 5, 166, 0, 5, 179,
+  0, 5, 188, 0, 5, 195, 0, 5, 203, 0, 5, 214, 0, 5, 227, 0,
+  5, 238, 0, 5, 251, 0, 6, 6, 0, 6, 19, 0, 6, 32, 0, 6,
+  45, 0, 6, 58, 0, 6, 73, 0, 6, 86, 0, 6, 99, 0, 6, 110,
+  0, 6, 121, 0, 6, 132, 0, 6, 145, 0, 6, 158, 0, 6, 169, 0,
+  6, 180, 0, 6, 193, 0, 6, 204, 0, 6, 215, 0, 6, 226, 0, 6,
+  237, 0, 6, 250, 0, 7, 5, 0, 7, 18, 0, 7, 31, 0, 7, 44,
+  0, 7, 53, 0, 7, 59, 0, 7, 72, 0, 7, 85, 0, 7, 98, 0,
+  7, 109, 0, 7, 123, 0, 7, 136, 0, 7, 150, 0, 7, 157, 0, 7,
+  170, 0, 7, 182, 0, 7, 193, 0, 7, 201, 0, 7, 208, 0, 7, 221,
+  0, 7, 228, 0, 7, 237, 0, 7, 249, 0, 8, 4, 0, 8, 15, 0,
+  8, 23, 0, 8, 35, 0, 8, 48, 0, 8, 55, 0, 8, 63, 0, 8,
+  74, 0, 8, 86, 0, 8, 97, 0, 8, 112, 0, 8, 127, 0, 8, 142,
+  0, 8, 155, 0, 8, 169, 0, 8, 183, 0, 8, 197, 0, 8, 211, 0,
+  8, 225, 0, 8, 239, 0, 8, 252, 0, 9, 11, 0, 9, 25, 0, 9,
+  39, 0, 9, 53, 0, 9, 67, 0, 9, 81, 0, 9, 95, 0, 9, 109,
+  0, 9, 123, 0, 9, 136, 0, 9, 150, 0, 9, 164, 0, 9, 178, 0,
+  9, 192, 0, 9, 206, 0, 9, 220, 0, 9, 231, 0, 9, 244, 0, 10,
+  2, 0, 10, 16, 0, 10, 30, 0, 10, 44, 0, 10, 58, 0, 10, 71,
+  0, 10, 84, 0, 10, 98, 0, 10, 112, 0, 10, 126, 0, 10, 140, 0,
+  10, 153, 0, 10, 167, 0, 10, 178, 0, 10, 191, 0, 10, 205, 0, 10,
+  219, 0, 10, 233, 0, 10, 246, 0, 11, 4, 0, 11, 18, 0, 11, 32,
+  0, 11, 45, 0, 11, 58, 0, 11, 72, 0, 11, 86, 0, 11, 100, 0,
+  11, 114, 0, 11, 128, 0, 11, 141, 0, 11, 152, 0, 11, 163, 0, 11,
+  177, 0, 11, 191, 0, 11, 205, 0, 11, 218, 0, 11, 233, 0, 11, 247,
+  0, 12, 6, 0, 12, 19, 0, 12, 30, 0, 12, 41, 0, 12, 52, 0,
+  12, 63, 0, 0, 0, 0, 12, 76, 0, 12, 87, 0, 12, 113, 0, 12,
+  139, 0, 0, 0, 6, 0, 8, 1, 7, 7, 6, 2, 0, 128, 128, 128,
+  128, 128, 0, 128, 3, 3, 3, 6, 1, 4, 160, 160, 160, 5, 7, 7,
+  6, 0, 0, 80, 80, 248, 80, 248, 80, 80, 5, 7, 7, 6, 0, 0,
+  32, 112, 160, 112, 40, 112, 32, 5, 7, 7, 6, 0, 0, 72, 168, 80,
+  32, 80, 168, 144, 5, 7, 7, 6, 0, 0, 64, 160, 160, 64, 168, 144,
+  104, 1, 3, 3, 6, 2, 4, 128, 128, 128, 3, 7, 7, 6, 1, 0,
+  32, 64, 128, 128, 128, 64, 32, 3, 7, 7, 6, 1, 0, 128, 64, 32,
+  32, 32, 64, 128, 5, 5, 5, 6, 0, 1, 136, 80, 248, 80, 136, 5,
+  5, 5, 6, 0, 1, 32, 32, 248, 32, 32, 3, 3, 3, 6, 1, 255,
+  96, 64, 128, 5, 1, 1, 6, 0, 3, 248, 3, 3, 3, 6, 1, 255,
+  64, 224, 64, 5, 7, 7, 6, 0, 0, 8, 8, 16, 32, 64, 128, 128,
+  5, 7, 7, 6, 0, 0, 32, 80, 136, 136, 136, 80, 32, 5, 7, 7,
+  6, 0, 0, 32, 96, 160, 32, 32, 32, 248, 5, 7, 7, 6, 0, 0,
+  112, 136, 8, 48, 64, 128, 248, 5, 7, 7, 6, 0, 0, 248, 8, 16,
+  48, 8, 136, 112, 5, 7, 7, 6, 0, 0, 16, 48, 80, 144, 248, 16,
+  16, 5, 7, 7, 6, 0, 0, 248, 128, 176, 200, 8, 136, 112, 5, 7,
+  7, 6, 0, 0, 48, 64, 128, 176, 200, 136, 112, 5, 7, 7, 6, 0,
+  0, 248, 8, 16, 16, 32, 64, 64, 5, 7, 7, 6, 0, 0, 112, 136,
+  136, 112, 136, 136, 112, 5, 7, 7, 6, 0, 0, 112, 136, 152, 104, 8,
+  16, 96, 3, 7, 7, 6, 1, 255, 64, 224, 64, 0, 64, 224, 64, 3,
+  7, 7, 6, 1, 255, 64, 224, 64, 0, 96, 64, 128, 4, 7, 7, 6,
+  1, 0, 16, 32, 64, 128, 64, 32, 16, 5, 3, 3, 6, 0, 2, 248,
+  0, 248, 4, 7, 7, 6, 1, 0, 128, 64, 32, 16, 32, 64, 128, 5,
+  7, 7, 6, 0, 0, 112, 136, 16, 32, 32, 0, 32, 5, 7, 7, 6,
+  0, 0, 112, 136, 152, 168, 176, 128, 112, 5, 7, 7, 6, 0, 0, 32,
+  80, 136, 136, 248, 136, 136, 5, 7, 7, 6, 0, 0, 240, 72, 72, 112,
+  72, 72, 240, 5, 7, 7, 6, 0, 0, 112, 136, 128, 128, 128, 136, 112,
+  5, 7, 7, 6, 0, 0, 240, 72, 72, 72, 72, 72, 240, 5, 7, 7,
+  6, 0, 0, 248, 128, 128, 240, 128, 128, 248, 5, 7, 7, 6, 0, 0,
+  248, 128, 128, 240, 128, 128, 128, 5, 7, 7, 6, 0, 0, 112, 136, 128,
+  128, 152, 136, 112, 5, 7, 7, 6, 0, 0, 136, 136, 136, 248, 136, 136,
+  136, 3, 7, 7, 6, 1, 0, 224, 64, 64, 64, 64, 64, 224, 5, 7,
+  7, 6, 0, 0, 56, 16, 16, 16, 16, 144, 96, 5, 7, 7, 6, 0,
+  0, 136, 144, 160, 192, 160, 144, 136, 5, 7, 7, 6, 0, 0, 128, 128,
+  128, 128, 128, 128, 248, 5, 7, 7, 6, 0, 0, 136, 136, 216, 168, 136,
+  136, 136, 5, 7, 7, 6, 0, 0, 136, 136, 200, 168, 152, 136, 136, 5,
+  7, 7, 6, 0, 0, 112, 136, 136, 136, 136, 136, 112, 5, 7, 7, 6,
+  0, 0, 240, 136, 136, 240, 128, 128, 128, 5, 8, 8, 6, 0, 255, 112,
+  136, 136, 136, 136, 168, 112, 8, 5, 7, 7, 6, 0, 0, 240, 136, 136,
+  240, 160, 144, 136, 5, 7, 7, 6, 0, 0, 112, 136, 128, 112, 8, 136,
+  112, 5, 7, 7, 6, 0, 0, 248, 32, 32, 32, 32, 32, 32, 5, 7,
+  7, 6, 0, 0, 136, 136, 136, 136, 136, 136, 112, 5, 7, 7, 6, 0,
+  0, 136, 136, 136, 80, 80, 80, 32, 5, 7, 7, 6, 0, 0, 136, 136,
+  136, 168, 168, 216, 136, 5, 7, 7, 6, 0, 0, 136, 136, 80, 32, 80,
+  136, 136, 5, 7, 7, 6, 0, 0, 136, 136, 80, 32, 32, 32, 32, 5,
+  7, 7, 6, 0, 0, 248, 8, 16, 32, 64, 128, 248, 3, 7, 7, 6,
+  1, 0, 224, 128, 128, 128, 128, 128, 224, 5, 7, 7, 6, 0, 0, 128,
+  128, 64, 32, 16, 8, 8, 3, 7, 7, 6, 1, 0, 224, 32, 32, 32,
+  32, 32, 224, 5, 3, 3, 6, 0, 4, 32, 80, 136, 5, 1, 1, 6,
+  0, 255, 248, 2, 2, 2, 6, 2, 6, 128, 64, 5, 5, 5, 6, 0,
+  0, 112, 8, 120, 136, 120, 5, 7, 7, 6, 0, 0, 128, 128, 176, 200,
+  136, 200, 176, 5, 5, 5, 6, 0, 0, 112, 136, 128, 136, 112, 5, 7,
+  7, 6, 0, 0, 8, 8, 104, 152, 136, 152, 104, 5, 5, 5, 6, 0,
+  0, 112, 136, 248, 128, 112, 5, 7, 7, 6, 0, 0, 48, 72, 64, 240,
+  64, 64, 64, 5, 7, 7, 6, 0, 254, 120, 136, 136, 120, 8, 136, 112,
+  5, 7, 7, 6, 0, 0, 128, 128, 176, 200, 136, 136, 136, 3, 7, 7,
+  6, 1, 0, 64, 0, 192, 64, 64, 64, 224, 4, 9, 9, 6, 1, 254,
+  16, 0, 48, 16, 16, 16, 144, 144, 96, 5, 7, 7, 6, 0, 0, 128,
+  128, 136, 144, 224, 144, 136, 3, 7, 7, 6, 1, 0, 192, 64, 64, 64,
+  64, 64, 224, 5, 5, 5, 6, 0, 0, 208, 168, 168, 168, 136, 5, 5,
+  5, 6, 0, 0, 176, 200, 136, 136, 136, 5, 5, 5, 6, 0, 0, 112,
+  136, 136, 136, 112, 5, 7, 7, 6, 0, 254, 176, 200, 136, 200, 176, 128,
+  128, 5, 7, 7, 6, 0, 254, 104, 152, 136, 152, 104, 8, 8, 5, 5,
+  5, 6, 0, 0, 176, 200, 128, 128, 128, 5, 5, 5, 6, 0, 0, 112,
+  128, 112, 8, 240, 5, 7, 7, 6, 0, 0, 64, 64, 240, 64, 64, 72,
+  48, 5, 5, 5, 6, 0, 0, 136, 136, 136, 152, 104, 5, 5, 5, 6,
+  0, 0, 136, 136, 80, 80, 32, 5, 5, 5, 6, 0, 0, 136, 136, 168,
+  168, 80, 5, 5, 5, 6, 0, 0, 136, 80, 32, 80, 136, 5, 7, 7,
+  6, 0, 254, 136, 136, 152, 104, 8, 136, 112, 5, 5, 5, 6, 0, 0,
+  248, 16, 32, 64, 248, 4, 7, 7, 6, 1, 0, 48, 64, 32, 192, 32,
+  64, 48, 1, 7, 7, 6, 2, 0, 128, 128, 128, 128, 128, 128, 128, 4,
+  7, 7, 6, 1, 0, 192, 32, 64, 48, 64, 32, 192, 5, 3, 3, 6,
+  0, 4, 72, 168, 144, 0, 0, 0, 6, 0, 8, 1, 7, 7, 6, 2,
+  0, 128, 0, 128, 128, 128, 128, 128, 5, 7, 7, 6, 0, 255, 32, 120,
+  160, 160, 160, 120, 32, 5, 7, 7, 6, 0, 0, 48, 72, 64, 224, 64,
+  72, 176, 5, 5, 5, 6, 0, 0, 136, 112, 80, 112, 136, 5, 8, 8,
+  6, 0, 255, 136, 136, 80, 32, 248, 32, 32, 32, 1, 7, 7, 6, 2,
+  0, 128, 128, 128, 0, 128, 128, 128, 5, 8, 8, 6, 0, 255, 112, 128,
+  224, 144, 72, 56, 8, 112, 3, 1, 1, 6, 1, 7, 160, 5, 7, 7,
+  6, 0, 0, 112, 136, 168, 200, 168, 136, 112, 4, 6, 6, 6, 1, 1,
+  112, 144, 176, 80, 0, 240, 6, 5, 5, 6, 0, 0, 36, 72, 144, 72,
+  36, 4, 2, 2, 6, 1, 2, 240, 16, 4, 1, 1, 6, 1, 3, 240,
+  5, 7, 7, 6, 0, 0, 112, 136, 232, 200, 200, 136, 112, 5, 1, 1,
+  6, 0, 7, 248, 3, 3, 3, 6, 1, 4, 64, 160, 64, 5, 6, 6,
+  6, 0, 0, 32, 32, 248, 32, 32, 248, 4, 5, 5, 6, 1, 3, 96,
+  144, 32, 64, 240, 4, 5, 5, 6, 1, 3, 224, 16, 96, 16, 224, 2,
+  2, 2, 6, 2, 6, 64, 128, 5, 6, 6, 6, 0, 255, 136, 136, 136,
+  200, 176, 128, 5, 7, 7, 6, 0, 0, 120, 232, 232, 104, 40, 40, 40,
+  1, 1, 1, 6, 2, 3, 128, 2, 2, 2, 6, 2, 254, 64, 128, 3,
+  5, 5, 6, 1, 3, 64, 192, 64, 64, 224, 4, 6, 6, 6, 1, 1,
+  96, 144, 144, 96, 0, 240, 6, 5, 5, 6, 0, 0, 144, 72, 36, 72,
+  144, 6, 9, 9, 6, 0, 255, 64, 192, 64, 64, 228, 12, 20, 60, 4,
+  6, 9, 9, 6, 0, 255, 64, 192, 64, 64, 232, 20, 4, 8, 28, 5,
+  9, 9, 6, 0, 255, 192, 32, 64, 32, 200, 24, 40, 120, 8, 5, 7,
+  7, 6, 0, 0, 32, 0, 32, 32, 64, 136, 112, 5, 8, 8, 6, 0,
+  0, 64, 32, 112, 136, 136, 248, 136, 136, 5, 8, 8, 6, 0, 0, 16,
+  32, 112, 136, 136, 248, 136, 136, 5, 8, 8, 6, 0, 0, 32, 80, 112,
+  136, 136, 248, 136, 136, 5, 8, 8, 6, 0, 0, 72, 176, 112, 136, 136,
+  248, 136, 136, 5, 8, 8, 6, 0, 0, 80, 0, 112, 136, 136, 248, 136,
+  136, 5, 8, 8, 6, 0, 0, 32, 80, 112, 136, 136, 248, 136, 136, 6,
+  7, 7, 6, 0, 0, 60, 80, 144, 156, 240, 144, 156, 5, 9, 9, 6,
+  0, 254, 112, 136, 128, 128, 128, 136, 112, 32, 64, 5, 8, 8, 6, 0,
+  0, 64, 248, 128, 128, 240, 128, 128, 248, 5, 8, 8, 6, 0, 0, 16,
+  248, 128, 128, 240, 128, 128, 248, 5, 8, 8, 6, 0, 0, 32, 248, 128,
+  128, 240, 128, 128, 248, 5, 8, 8, 6, 0, 0, 80, 248, 128, 128, 240,
+  128, 128, 248, 3, 8, 8, 6, 1, 0, 128, 64, 224, 64, 64, 64, 64,
+  224, 3, 8, 8, 6, 1, 0, 32, 64, 224, 64, 64, 64, 64, 224, 3,
+  8, 8, 6, 1, 0, 64, 160, 224, 64, 64, 64, 64, 224, 3, 8, 8,
+  6, 1, 0, 160, 0, 224, 64, 64, 64, 64, 224, 5, 7, 7, 6, 0,
+  0, 240, 72, 72, 232, 72, 72, 240, 5, 8, 8, 6, 0, 0, 40, 80,
+  136, 200, 168, 152, 136, 136, 5, 8, 8, 6, 0, 0, 64, 32, 112, 136,
+  136, 136, 136, 112, 5, 8, 8, 6, 0, 0, 16, 32, 112, 136, 136, 136,
+  136, 112, 5, 8, 8, 6, 0, 0, 32, 80, 112, 136, 136, 136, 136, 112,
+  5, 8, 8, 6, 0, 0, 40, 80, 112, 136, 136, 136, 136, 112, 5, 8,
+  8, 6, 0, 0, 80, 0, 112, 136, 136, 136, 136, 112, 5, 5, 5, 6,
+  0, 0, 136, 80, 32, 80, 136, 5, 7, 7, 6, 0, 0, 112, 152, 152,
+  168, 200, 200, 112, 5, 8, 8, 6, 0, 0, 64, 32, 136, 136, 136, 136,
+  136, 112, 5, 8, 8, 6, 0, 0, 16, 32, 136, 136, 136, 136, 136, 112,
+  5, 8, 8, 6, 0, 0, 32, 80, 0, 136, 136, 136, 136, 112, 5, 8,
+  8, 6, 0, 0, 80, 0, 136, 136, 136, 136, 136, 112, 5, 8, 8, 6,
+  0, 0, 16, 32, 136, 136, 80, 32, 32, 32, 5, 7, 7, 6, 0, 0,
+  128, 240, 136, 240, 128, 128, 128, 5, 7, 7, 6, 0, 0, 112, 136, 144,
+  160, 144, 136, 176, 5, 8, 8, 6, 0, 0, 64, 32, 0, 112, 8, 120,
+  136, 120, 5, 8, 8, 6, 0, 0, 16, 32, 0, 112, 8, 120, 136, 120,
+  5, 8, 8, 6, 0, 0, 32, 80, 0, 112, 8, 120, 136, 120, 5, 8,
+  8, 6, 0, 0, 40, 80, 0, 112, 8, 120, 136, 120, 5, 7, 7, 6,
+  0, 0, 80, 0, 112, 8, 120, 136, 120, 5, 8, 8, 6, 0, 0, 32,
+  80, 32, 112, 8, 120, 136, 120, 6, 5, 5, 6, 0, 0, 120, 20, 124,
+  144, 124, 5, 7, 7, 6, 0, 254, 112, 136, 128, 136, 112, 32, 64, 5,
+  8, 8, 6, 0, 0, 64, 32, 0, 112, 136, 248, 128, 112, 5, 8, 8,
+  6, 0, 0, 16, 32, 0, 112, 136, 248, 128, 112, 5, 8, 8, 6, 0,
+  0, 32, 80, 0, 112, 136, 248, 128, 112, 5, 7, 7, 6, 0, 0, 80,
+  0, 112, 136, 248, 128, 112, 3, 8, 8, 6, 1, 0, 128, 64, 0, 192,
+  64, 64, 64, 224, 3, 8, 8, 6, 1, 0, 64, 128, 0, 192, 64, 64,
+  64, 224, 3, 8, 8, 6, 1, 0, 64, 160, 0, 192, 64, 64, 64, 224,
+  3, 7, 7, 6, 1, 0, 160, 0, 192, 64, 64, 64, 224, 5, 7, 7,
+  6, 0, 0, 192, 48, 112, 136, 136, 136, 112, 5, 8, 8, 6, 0, 0,
+  40, 80, 0, 176, 200, 136, 136, 136, 5, 8, 8, 6, 0, 0, 64, 32,
+  0, 112, 136, 136, 136, 112, 5, 8, 8, 6, 0, 0, 16, 32, 0, 112,
+  136, 136, 136, 112, 5, 8, 8, 6, 0, 0, 32, 80, 0, 112, 136, 136,
+  136, 112, 5, 8, 8, 6, 0, 0, 40, 80, 0, 112, 136, 136, 136, 112,
+  5, 7, 7, 6, 0, 0, 80, 0, 112, 136, 136, 136, 112, 5, 5, 5,
+  6, 0, 1, 32, 0, 248, 0, 32, 5, 5, 5, 6, 0, 0, 120, 152,
+  168, 200, 240, 5, 8, 8, 6, 0, 0, 64, 32, 0, 136, 136, 136, 152,
+  104, 5, 8, 8, 6, 0, 0, 16, 32, 0, 136, 136, 136, 152, 104, 5,
+  8, 8, 6, 0, 0, 32, 80, 0, 136, 136, 136, 152, 104, 5, 7, 7,
+  6, 0, 0, 80, 0, 136, 136, 136, 152, 104, 5, 9, 9, 6, 0, 254,
+  16, 32, 136, 136, 152, 104, 8, 136, 112, 5, 8, 8, 6, 0, 254, 128,
+  240, 136, 136, 136, 240, 128, 128, 5, 9, 9, 6, 0, 254, 80, 0, 136,
+  136, 152, 104, 8, 136, 112, 5, 7, 7, 6, 0, 0, 248, 136, 136, 136,
+  136, 136, 136, 5, 5, 5, 6, 0, 0, 240, 136, 240, 136, 240, 5, 5,
+  5, 6, 0, 0, 112, 136, 248, 128, 112, 5, 5, 5, 6, 0, 0, 136,
+  152, 168, 200, 136, 5, 5, 5, 6, 0, 0, 136, 216, 168, 136, 136, 5,
+  7, 7, 6, 0, 254, 240, 136, 136, 136, 240, 128, 128, 5, 5, 5, 6,
+  0, 0, 248, 32, 32, 32, 32, 9, 10, 20, 10, 0, 254, 8, 0, 8,
+  0, 255, 128, 136, 128, 136, 128, 136, 128, 255, 128, 8, 0, 8, 0, 8,
+  0, 9, 10, 20, 10, 0, 254, 8, 0, 8, 0, 255, 128, 34, 0, 34,
+  0, 20, 0, 8, 0, 20, 0, 99, 0, 128, 128, 5, 7, 7, 6, 0,
+  0, 248, 136, 232, 216, 248, 216, 248
+};
+
 /*
   Fontname: -Misc-Fixed-Medium-R-SemiCondensed--12-110-75-75-C-60-ISO10646-1
   Copyright: Public domain terminal emulator font.  Share and enjoy.
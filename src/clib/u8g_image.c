@@ -0,0 +1,139 @@
+/*
+
+  u8g_image.c
+
+  Compressed 1 bit images for flash, see extras/u8g_image_rle.c
+
+  offset
+    0   format, 0: PackBits rows
+    1   width (2 bytes, msb first)
+    3   height (2 bytes, msb first)
+    5   n: the seek table has one entry for every 2^n rows
+    6   seek table: start of row 0, 2^n, 2*2^n, ... (2 bytes each, msb
+        first), relative to the first byte after the table
+    ... rows
+
+  A row has (width+7)/8 bytes (msb is the left pixel, like u8g_DrawBitmapP()),
+  each row is PackBits encoded on its own. A control byte c is followed by
+  c+1 literal bytes for c < 128, or by one byte which is repeated 257-c times
+  for c > 128. c = 128 is ignored.
+
+  On each page only the rows inside the page are decoded: the decoder starts
+  at the seek table entry before the first row of the page and skips the
+  remaining rows up to the page. Set pixel are drawn with the current color,
+  clear pixel are not drawn.
+
+*/
+
+#include "u8g.h"
+
+#define U8G_IMAGE_HEADER 6
+
+/* runs of 0xff are drawn as lines of at most this number of bytes */
+#define U8G_IMAGE_HLINE_MAX 16
+
+static uint16_t u8g_image_get_word(const u8g_pgm_uint8_t *image, uint16_t offset) {
+  uint16_t v;
+  image += offset;
+  v = u8g_pgm_read(image);
+  image++;
+  v <<= 8;
+  v += u8g_pgm_read(image);
+  return v;
+}
+
+uint16_t u8g_GetImageWidth(const u8g_pgm_uint8_t *image) {
+  return u8g_image_get_word(image, 1);
+}
+
+uint16_t u8g_GetImageHeight(const u8g_pgm_uint8_t *image) {
+  return u8g_image_get_word(image, 3);
+}
+
+static void u8g_image_draw_run(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t n, uint8_t b) {
+  uint8_t k;
+  if (b == 0)
+    return;
+  if (b == 255) {
+    while (n > 0) {
+      k = n > U8G_IMAGE_HLINE_MAX ? U8G_IMAGE_HLINE_MAX : n;
+      u8g_DrawHLine(u8g, x, y, (u8g_uint_t)k * 8);
+      x += (u8g_uint_t)k * 8;
+      n -= k;
+    }
+    return;
+  }
+  while (n > 0) {
+    u8g_Draw8Pixel(u8g, x, y, 0, b);
+    x += 8;
+    n--;
+  }
+}
+
+/* decode one row of cnt bytes, draw it only if is_draw is not 0, returns the start of the next row */
+static const u8g_pgm_uint8_t *u8g_image_row(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *p, uint16_t cnt, uint8_t is_draw) {
+  uint8_t c, n, b;
+  while (cnt > 0) {
+    c = u8g_pgm_read(p);
+    p++;
+    if (c == 128)
+      continue;
+    if (c < 128) {
+      n = c + 1;
+      if (is_draw) {
+        for ( c = 0; c < n; c++ ) {
+          b = u8g_pgm_read(p + c);
+          if (b != 0)
+            u8g_Draw8Pixel(u8g, x + (u8g_uint_t)c * 8, y, 0, b);
+        }
+      }
+      p += n;
+    }
+    else {
+      n = 257 - c;
+      if (is_draw)
+        u8g_image_draw_run(u8g, x, y, n, u8g_pgm_read(p));
+      p++;
+    }
+    x += (u8g_uint_t)n * 8;
+    cnt = n < cnt ? cnt - n : 0;
+  }
+  return p;
+}
+
+void u8g_DrawImageP(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *image) {
+  u8g_uint_t w, h, r, r_first, r_last;
+  uint16_t cnt;
+  uint8_t shift;
+  const u8g_pgm_uint8_t *p;
+
+  if (u8g_pgm_read(image) != 0)
+    return;
+  w = u8g_GetImageWidth(image);
+  h = u8g_GetImageHeight(image);
+  if (w == 0 || h == 0)
+    return;
+  if (u8g_IsBBXIntersection(u8g, x, y, w, h) == 0)
+    return;
+
+  if (u8g_GetPageRows(u8g, y, h, &r_first, &r_last) == 0)
+    return;
+
+  cnt = ((uint16_t)w + 7) / 8;
+  shift = u8g_pgm_read(image + 5);
+
+  /* start at the seek table entry before the first row inside the page */
+  r = r_first >> shift;
+  p = image + U8G_IMAGE_HEADER + ((((uint16_t)h - 1) >> shift) + 1) * 2;
+  p += u8g_image_get_word(image, U8G_IMAGE_HEADER + r * 2);
+  r <<= shift;
+
+  for ( ; r < r_first; r++ )
+    p = u8g_image_row(u8g, x, y, p, cnt, 0);
+  for ( ;; ) {
+    p = u8g_image_row(u8g, x, y + r, p, cnt, 1);
+    if (r == r_last)
+      break;
+    r++;
+  }
+}
@@ -83,3 +83,77 @@ void u8g_DrawLine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_u
     }
   }
 }
+
+/*
+  Anti aliased line (Xiaolin Wu) for gray devices: for each step along the
+  major axis the two pixel next to the ideal line share the coverage 3,
+  split by the distance to the line (see u8g_DrawTPixel()).
+  Other devices get the line of u8g_DrawLine().
+*/
+void u8g_DrawAALine(u8g_t *u8g, u8g_uint_t x1, u8g_uint_t y1, u8g_uint_t x2, u8g_uint_t y2) {
+  u8g_uint_t tmp;
+  u8g_uint_t x, y;
+  u8g_uint_t dx, dy;
+  u8g_uint_t err, e1, e2, e3;
+  u8g_int_t ystep;
+  uint8_t coverage;
+  uint8_t mode = u8g_GetMode(u8g);
+
+  uint8_t swapxy = 0;
+
+  if (mode != U8G_MODE_GRAY2BIT && mode != U8G_MODE_GRAY4BIT) {
+    u8g_DrawLine(u8g, x1, y1, x2, y2);
+    return;
+  }
+
+  if (x1 > x2) dx = x1 - x2; else dx = x2 - x1;
+  if (y1 > y2) dy = y1 - y2; else dy = y2 - y1;
+
+  if (dy > dx) {
+    swapxy = 1;
+    tmp = dx; dx = dy; dy = tmp;
+    tmp = x1; x1 = y1; y1 = tmp;
+    tmp = x2; x2 = y2; y2 = tmp;
+  }
+  if (x1 > x2) {
+    tmp = x1; x1 = x2; x2 = tmp;
+    tmp = y1; y1 = y2; y2 = tmp;
+  }
+  if (y2 > y1) ystep = 1; else ystep = -1;
+
+  // err / dx is the distance to the line, thresholds for coverage 1, 2 and 3
+  e1 = dx / 6;
+  e2 = dx / 2;
+  e3 = dx - e1;
+  err = 0;
+  y = y1;
+
+  for ( x = x1; ; x++ ) {
+    coverage = 0;
+    if (err > e1) coverage++;
+    if (err > e2) coverage++;
+    if (err > e3) coverage++;
+    if (swapxy == 0) {
+      if (coverage != 3)
+        u8g_DrawTPixel(u8g, x, y, 3 - coverage);
+      if (coverage != 0)
+        u8g_DrawTPixel(u8g, x, y + ystep, coverage);
+    }
+    else {
+      if (coverage != 3)
+        u8g_DrawTPixel(u8g, y, x, 3 - coverage);
+      if (coverage != 0)
+        u8g_DrawTPixel(u8g, y + ystep, x, coverage);
+    }
+    if (x == x2)
+      break;
+    // err += dy without overflow
+    if (err >= dx - dy) {
+      err -= dx - dy;
+      y += (u8g_uint_t)ystep;
+    }
+    else {
+      err += dy;
+    }
+  }
+}
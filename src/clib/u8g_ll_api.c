@@ -42,6 +42,25 @@ uint8_t u8g_call_dev_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   return dev->dev_fn(u8g, dev, msg, arg);
 }
 
+/*
+  Deferred page buffer clear (see u8g_pb_ClearPage): executed by the drawing
+  procedures before the first pixel of the page and by u8g_NextPageLL before
+  the transfer of an empty page. Other device messages are not affected.
+*/
+static void u8g_clear_pending(u8g_t *u8g, u8g_dev_t *dev) {
+  u8g->pb_clear &= ~U8G_PB_CLEAR_PENDING;
+  dev->dev_fn(u8g, dev, U8G_DEV_MSG_CLEAR_PAGE, NULL);
+}
+
+/* page buffer for the direct fast path (see U8G_DEV_MSG_GET_PB_FNS) or NULL */
+u8g_pb_t *u8g_get_direct_pb(u8g_t *u8g) {
+  if (u8g->pb_fns == NULL)
+    return NULL;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, u8g->dev);
+  return u8g->pb_direct;
+}
+
 //====================================================================
 
 uint8_t u8g_InitLL(u8g_t *u8g, u8g_dev_t *dev) {
@@ -56,6 +75,8 @@ uint8_t u8g_InitLL(u8g_t *u8g, u8g_dev_t *dev) {
 void u8g_FirstPageLL(u8g_t *u8g, u8g_dev_t *dev) {
   u8g->state_cb(U8G_STATE_MSG_BACKUP_ENV);
   u8g->state_cb(U8G_STATE_MSG_RESTORE_U8G);
+  u8g->pb_clear &= ~U8G_PB_CLEAR_PENDING;
+  u8g->pb_clear |= U8G_PB_CLEAR_DEFER;
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_PAGE_FIRST, NULL);
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_GET_PAGE_BOX, &(u8g->current_page));
   u8g->state_cb(U8G_STATE_MSG_RESTORE_ENV);
@@ -65,9 +86,13 @@ uint8_t u8g_NextPageLL(u8g_t *u8g, u8g_dev_t *dev) {
   uint8_t r;
   u8g->state_cb(U8G_STATE_MSG_BACKUP_ENV);
   u8g->state_cb(U8G_STATE_MSG_RESTORE_U8G);
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, dev);
   r = u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_PAGE_NEXT, NULL);
   if (r != 0)
     u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_GET_PAGE_BOX, &(u8g->current_page));
+  else
+    u8g->pb_clear = 0;    // end of frame, the opaque hint is valid for one frame only
   u8g->state_cb(U8G_STATE_MSG_RESTORE_ENV);
   return r;
 }
@@ -80,6 +105,8 @@ void u8g_DrawPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y) {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
   arg->x = x;
   arg->y = y;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, dev);
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_PIXEL, arg);
 }
 
@@ -89,6 +116,8 @@ void u8g_Draw8PixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, ui
   arg->y = y;
   arg->dir = dir;
   arg->pixel = pixel;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, dev);
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_8PIXEL, arg);
 }
 
@@ -98,6 +127,8 @@ void u8g_Draw4TPixelLL(u8g_t *u8g, u8g_dev_t *dev, u8g_uint_t x, u8g_uint_t y, u
   arg->y = y;
   arg->dir = dir;
   arg->pixel = pixel;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, dev);
   u8g_call_dev_fn(u8g, dev, U8G_DEV_MSG_SET_4TPIXEL, arg);
 }
 
@@ -129,6 +160,23 @@ void u8g_UpdateDimension(u8g_t *u8g) {
   u8g->width = u8g_GetWidthLL(u8g, u8g->dev);
   u8g->height = u8g_GetHeightLL(u8g, u8g->dev);
   u8g->mode = u8g_GetModeLL(u8g, u8g->dev);
+  {
+    // check for optional messages: an empty block is marked as done by supporting devices
+    u8g_dev_arg_8x8_t block;
+    block.cnt = 0;
+    block.is_done = 0;
+    u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_8X8PIXEL, &block);
+    u8g->dev_caps = block.is_done ? U8G_DEV_CAP_8X8PIXEL : 0;
+  }
+  {
+    // direct page buffer access, not available if a transformation is part of the device chain
+    u8g_dev_arg_pb_fns_t pb_fns;
+    pb_fns.fns = NULL;
+    pb_fns.pb = NULL;
+    u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_GET_PB_FNS, &pb_fns);
+    u8g->pb_fns = pb_fns.pb != NULL ? pb_fns.fns : NULL;
+    u8g->pb_direct = pb_fns.pb;
+  }
   // 9 Dec 2012: u8g_scale.c requires update of current page
   u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_GET_PAGE_BOX, &(u8g->current_page));
 }
@@ -160,6 +208,14 @@ static void u8g_init_data(u8g_t *u8g) {
 
   u8g->state_cb = u8g_state_dummy_cb;
 
+  u8g->dev_caps = 0;
+  u8g->pb_fns = NULL;
+  u8g->pb_direct = NULL;
+  u8g->pb_clear = 0;
+  u8g->pb_clear_value = 0;
+
+  u8g->str_cache = NULL;
+  u8g->str_cache_size = 0;
 }
 
 uint8_t u8g_Begin(u8g_t *u8g) {
@@ -348,6 +404,19 @@ void u8g_FirstPage(u8g_t *u8g) {
   u8g_FirstPageLL(u8g, u8g->dev);
 }
 
+/*
+  Picture loop over the pages which intersect the box, continue with
+  u8g_NextPage() as usual. The pages are cleared completely, so everything
+  which intersects the page must be drawn, not only the content of the box.
+  A virtual screen and devices without page buffer draw all pages. A mirror
+  device sends the box to all displays, they draw all pages if one of them
+  has no page range.
+*/
+void u8g_FirstPageInBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
+  u8g_SetFrameBox(u8g, x, y, w, h);
+  u8g_FirstPageLL(u8g, u8g->dev);
+}
+
 uint8_t u8g_NextPage(u8g_t *u8g) {
   if  (u8g->cursor_fn != (u8g_draw_cursor_fn)0)
     u8g->cursor_fn(u8g);
@@ -366,11 +435,55 @@ void u8g_SleepOff(u8g_t *u8g) {
   u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SLEEP_OFF, NULL);
 }
 
+/*
+  Hardware scrolling (outside of the picture loop): the display shows the
+  row "line" of its RAM at the top, line must be a multiple of the page
+  height. The next frame covers only the rows which are scrolled into view.
+  Returns 0 if the display does not support a start line.
+*/
+uint8_t u8g_SetStartLine(u8g_t *u8g, u8g_uint_t line) {
+  u8g_dev_arg_start_line_t arg;
+  arg.line = line;
+  arg.n = 0;
+  arg.is_relative = 0;
+  arg.is_done = 0;
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_START_LINE, &arg);
+  return arg.is_done;
+}
+
+/* n > 0: the content moves up by n rows, new rows appear at the bottom */
+uint8_t u8g_ScrollVertical(u8g_t *u8g, u8g_int_t n) {
+  u8g_dev_arg_start_line_t arg;
+  arg.line = 0;
+  arg.n = n;
+  arg.is_relative = 1;
+  arg.is_done = 0;
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_START_LINE, &arg);
+  return arg.is_done;
+}
+
 void u8g_DrawPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y) {
+  u8g_pb_t *pb = u8g_get_direct_pb(u8g);
+  if (pb != NULL) {
+    u8g->arg_pixel.x = x;
+    u8g->arg_pixel.y = y;
+    u8g->pb_fns->set_pixel(pb, &(u8g->arg_pixel));
+    return;
+  }
   u8g_DrawPixelLL(u8g, u8g->dev, x, y);
 }
 
 void u8g_Draw8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_t pixel) {
+  u8g_pb_t *pb = u8g_get_direct_pb(u8g);
+  if (pb != NULL) {
+    u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+    arg->x = x;
+    arg->y = y;
+    arg->dir = dir;
+    arg->pixel = pixel;
+    u8g->pb_fns->set_8pixel(pb, arg);
+    return;
+  }
   u8g_Draw8PixelLL(u8g, u8g->dev, x, y, dir, pixel);
 }
 
@@ -378,6 +491,19 @@ void u8g_Draw4TPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t dir, uint8_
   u8g_Draw4TPixelLL(u8g, u8g->dev, x, y, dir, pixel);
 }
 
+// transparent pixel with coverage 0..3, supported by the gray devices
+void u8g_DrawTPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t coverage) {
+  u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
+  uint8_t color = arg->color;
+  arg->x = x;
+  arg->y = y;
+  arg->color = coverage;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, u8g->dev);
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_TPIXEL, arg);
+  arg->color = color;
+}
+
 void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixel) {
   u8g_dev_arg_pixel_t *arg = &(u8g->arg_pixel);
   arg->x = x;
@@ -385,9 +511,45 @@ void u8g_Draw8ColorPixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t colpixe
   arg->dir = 0;
   arg->pixel = 0x80;
   arg->color = colpixel;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_clear_pending(u8g, u8g->dev);
   u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_8PIXEL, arg);
 }
 
+/*
+  Draw cnt (1..8) rows of 8 pixel, rows[0] is at y, msb is the left pixel.
+  Devices with U8G_DEV_CAP_8X8PIXEL receive one block, all others one row after the other.
+*/
+void u8g_Draw8x8Pixel(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, uint8_t cnt, const uint8_t *rows) {
+  if (u8g->dev_caps & U8G_DEV_CAP_8X8PIXEL) {
+    u8g_dev_arg_8x8_t block;
+    u8g_pb_t *pb;
+    uint8_t i;
+    block.x = x;
+    block.y = y;
+    for ( i = 0; i < cnt; i++ )
+      block.rows[i] = rows[i];
+    block.cnt = cnt;
+    block.color = u8g->arg_pixel.color;
+    block.is_done = 0;
+    pb = u8g_get_direct_pb(u8g);
+    if (pb != NULL && u8g->pb_fns->set_8x8pixel != NULL)
+      u8g->pb_fns->set_8x8pixel(pb, &block);
+    else {
+      if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+        u8g_clear_pending(u8g, u8g->dev);
+      u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_8X8PIXEL, &block);
+    }
+    return;
+  }
+  while (cnt > 0) {
+    u8g_Draw8Pixel(u8g, x, y, 0, *rows);
+    rows++;
+    y++;
+    cnt--;
+  }
+}
+
 // u8g_IsBBXIntersection() has been moved to u8g_clip.c
 #ifdef OBSOLETE_CODE
   uint8_t u8g_IsBBXIntersection(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
@@ -424,6 +586,44 @@ void u8g_SetColorIndex(u8g_t *u8g, uint8_t idx) {
   //u8g->color_index = idx; */ /* must be removed
 }
 
+/*
+  Hint: every page of the next frame is fully overwritten (background box or bitmap),
+  the page buffer clear is skipped. Call before u8g_FirstPage(), valid for one frame.
+*/
+void u8g_SetOpaqueFrame(u8g_t *u8g) {
+  u8g->pb_clear |= U8G_PB_CLEAR_OPAQUE;
+}
+
+/*
+  Hint: only the box has changed. The next frame covers only the pages which
+  intersect the box, all other pages are neither drawn nor transfered. Call
+  before u8g_FirstPage(), valid for one frame, boxes of the same frame are
+  combined. Devices which can not update single pages draw the full frame.
+*/
+void u8g_SetFrameBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
+  u8g_box_t box;
+  if (w == 0 || h == 0 || x >= u8g->width || y >= u8g->height)
+    return;
+  box.x0 = x;
+  box.y0 = y;
+  box.x1 = x + w - 1;
+  box.y1 = y + h - 1;
+  if (box.x1 < x || box.x1 >= u8g->width)
+    box.x1 = u8g->width - 1;
+  if (box.y1 < y || box.y1 >= u8g->height)
+    box.y1 = u8g->height - 1;
+  u8g_call_dev_fn(u8g, u8g->dev, U8G_DEV_MSG_SET_FRAME_BOX, &box);
+}
+
+/*
+  Page buffer content after clear: the memory content of one pixel, low byte first
+  (u8g_SetHiColor() value for pbxh16, r | g<<8 | b<<16 for pbxh24, one byte for
+  devices with less than 8 bits per pixel, e.g. 0xff for an inverted background)
+*/
+void u8g_SetClearValue(u8g_t *u8g, uint32_t value) {
+  u8g->pb_clear_value = value;
+}
+
 void u8g_SetHiColor(u8g_t *u8g, uint16_t rgb) {
   u8g->arg_pixel.color = rgb & 255;
   u8g->arg_pixel.hi_color = rgb >> 8;
@@ -472,6 +672,8 @@ uint8_t u8g_GetDefaultForegroundColor(u8g_t *u8g) {
     return 255;     // white
   else if (u8g_GetMode(u8g) == U8G_MODE_GRAY2BIT)
     return 3;         // max intensity
+  else if (mode == U8G_MODE_GRAY4BIT)
+    return 15;        // max intensity
   // if ( u8g.getMode() == U8G_MODE_BW )
   return 1;         // pixel on
 }
@@ -487,6 +689,7 @@ void u8g_SetDefaultForegroundColor(u8g_t *u8g) {
 }
 
 uint8_t u8g_GetDefaultBackgroundColor(u8g_t *u8g) {
+  (void)u8g;
   return 0;
 }
 
@@ -501,6 +704,8 @@ uint8_t u8g_GetDefaultMidColor(u8g_t *u8g) {
     return 0x06d;     // gray: 01101101
   else if (mode == U8G_MODE_GRAY2BIT)
     return 1;         // low mid intensity
+  else if (mode == U8G_MODE_GRAY4BIT)
+    return 7;         // mid intensity
   // if ( u8g.getMode() == U8G_MODE_BW )
   return 1;         // pixel on
 }
@@ -0,0 +1,257 @@
+/*
+
+  u8g_mirror.c
+
+  Mirror device: Render each page once and transfer it to several displays.
+
+  The first child added with u8g_AddToMirror() is the primary device. All drawing
+  goes into its page buffer. With U8G_DEV_MSG_PAGE_NEXT the page buffer is copied
+  (same layout) or converted (different 1 bit layout) into the page buffer of each
+  other child, followed by the PAGE_NEXT (transfer) of that child.
+  Hardware scrolling (U8G_DEV_MSG_SET_START_LINE) and the frame box
+  (U8G_DEV_MSG_SET_FRAME_BOX) are sent to all children.
+
+  Requirements for all children:
+    - the device of the child u8g_t must be a page buffer device (dev_mem is a u8g_pb_t)
+    - same width, total height and page height as the primary device
+
+*/
+
+#include "u8g.h"
+#include <string.h>
+
+static uint8_t u8g_mirror_bits_per_pixel(uint8_t layout) {
+  if (layout == U8G_MIRROR_V2 || layout == U8G_MIRROR_H2)
+    return 2;
+  return 1;
+}
+
+static u8g_pb_t *u8g_mirror_pb(u8g_mirror_child_t *c) {
+  return (u8g_pb_t *)(c->u8g->dev->dev_mem);
+}
+
+static uint8_t u8g_mirror_call(u8g_mirror_child_t *c, uint8_t msg, void *arg) {
+  return u8g_call_dev_fn(c->u8g, c->u8g->dev, msg, arg);
+}
+
+static uint8_t u8g_mirror_reverse(uint8_t b) {
+  b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
+  b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+/*
+  Read one 8x8 block as 8 rows, msb is the left pixel.
+  plane: 8 pixel rows of the page, x: first column of the block, n: number of valid columns
+*/
+static void u8g_mirror_get_block(u8g_pb_t *pb, uint8_t layout, uint8_t plane, u8g_uint_t x, uint8_t n, uint8_t *rows) {
+  uint8_t *ptr = (uint8_t *)pb->buf;
+  uint8_t r, c, b;
+
+  if (layout == U8G_MIRROR_V1) {
+    ptr += (uint16_t)plane * pb->width + x;
+    memset(rows, 0, 8);
+    for ( c = 0; c < n; c++ ) {
+      b = ptr[c];
+      for ( r = 0; r < 8; r++ ) {
+        if (b & 1)
+          rows[r] |= 0x080 >> c;
+        b >>= 1;
+      }
+    }
+  }
+  else {
+    ptr += (uint16_t)plane * pb->width + (x >> 3);
+    for ( r = 0; r < 8; r++ ) {
+      b = *ptr;
+      rows[r] = layout == U8G_MIRROR_H1F ? u8g_mirror_reverse(b) : b;
+      ptr += pb->width >> 3;
+    }
+  }
+}
+
+static void u8g_mirror_set_block(u8g_pb_t *pb, uint8_t layout, uint8_t plane, u8g_uint_t x, uint8_t n, const uint8_t *rows) {
+  uint8_t *ptr = (uint8_t *)pb->buf;
+  uint8_t r, c, b, mask;
+
+  if (layout == U8G_MIRROR_V1) {
+    ptr += (uint16_t)plane * pb->width + x;
+    for ( c = 0; c < n; c++ ) {
+      mask = 0x080 >> c;
+      b = 0;
+      for ( r = 8; r > 0; r-- ) {
+        b <<= 1;
+        if (rows[r - 1] & mask)
+          b |= 1;
+      }
+      ptr[c] = b;
+    }
+  }
+  else {
+    ptr += (uint16_t)plane * pb->width + (x >> 3);
+    for ( r = 0; r < 8; r++ ) {
+      *ptr = layout == U8G_MIRROR_H1F ? u8g_mirror_reverse(rows[r]) : rows[r];
+      ptr += pb->width >> 3;
+    }
+  }
+}
+
+static void u8g_mirror_convert(u8g_pb_t *src, uint8_t src_layout, u8g_pb_t *dest, uint8_t dest_layout) {
+  uint8_t rows[8];
+  uint8_t plane, planes, n;
+  u8g_uint_t x;
+
+  planes = src->p.page_height >> 3;
+  for ( plane = 0; plane < planes; plane++ ) {
+    for ( x = 0; x < src->width; x += 8 ) {
+      n = 8;
+      if ((u8g_uint_t)(src->width - x) < 8)
+        n = src->width - x;
+      u8g_mirror_get_block(src, src_layout, plane, x, n, rows);
+      u8g_mirror_set_block(dest, dest_layout, plane, x, n, rows);
+    }
+  }
+}
+
+static void u8g_mirror_copy_page(u8g_mirror_child_t *primary, u8g_mirror_child_t *c) {
+  u8g_pb_t *src = u8g_mirror_pb(primary);
+  u8g_pb_t *dest = u8g_mirror_pb(c);
+  if (src->buf == dest->buf)
+    return;
+  if (primary->layout == c->layout)
+    memcpy(dest->buf, src->buf, (uint16_t)src->width * src->p.page_height / 8 * u8g_mirror_bits_per_pixel(c->layout));
+  else
+    u8g_mirror_convert(src, primary->layout, dest, c->layout);
+}
+
+/*
+  Children with a different page range (U8G_DEV_MSG_SET_START_LINE or
+  U8G_DEV_MSG_SET_FRAME_BOX) would not run through the same pages as the
+  primary: all of them draw the full frame.
+*/
+static void u8g_mirror_sync_range(u8g_mirror_t *m) {
+  u8g_page_t *p = &(u8g_mirror_pb(m->first)->p);
+  u8g_page_t *q;
+  u8g_mirror_child_t *c;
+
+  for ( c = m->first->next; c != NULL; c = c->next ) {
+    q = &(u8g_mirror_pb(c)->p);
+    if (q->is_range != p->is_range)
+      break;
+    if (p->is_range == 1 && (q->range_y0 != p->range_y0 || q->range_y1 != p->range_y1))
+      break;
+  }
+  if (c == NULL)
+    return;
+  for ( c = m->first; c != NULL; c = c->next )
+    u8g_mirror_pb(c)->p.is_range = 2;
+}
+
+uint8_t u8g_dev_mirror_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+  u8g_mirror_t *m = (u8g_mirror_t *)(dev->dev_mem);
+  u8g_mirror_child_t *c;
+  (void)u8g;
+
+  if (m->first == NULL) {
+    if (msg == U8G_DEV_MSG_GET_WIDTH || msg == U8G_DEV_MSG_GET_HEIGHT)
+      *((u8g_uint_t *)arg) = 0;
+    return 0;
+  }
+
+  switch (msg) {
+    default:
+      // drawing and page box: primary device only
+      return u8g_mirror_call(m->first, msg, arg);
+    case U8G_DEV_MSG_INIT:
+    case U8G_DEV_MSG_STOP:
+    case U8G_DEV_MSG_CONTRAST:
+    case U8G_DEV_MSG_SLEEP_ON:
+    case U8G_DEV_MSG_SLEEP_OFF:
+    case U8G_DEV_MSG_PAGE_FIRST:
+    case U8G_DEV_MSG_SET_COLOR_ENTRY: {
+      uint8_t r = 1;
+      for ( c = m->first; c != NULL; c = c->next )
+        if (u8g_mirror_call(c, msg, arg) == 0)
+          r = 0;
+      return r;
+    }
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      // all children run through the pages of the box
+      for ( c = m->first; c != NULL; c = c->next )
+        u8g_mirror_call(c, msg, arg);
+      u8g_mirror_sync_range(m);
+      return 1;
+    case U8G_DEV_MSG_SET_START_LINE: {
+      // all children scroll, is_done only if all of them did
+      u8g_dev_arg_start_line_t *a = (u8g_dev_arg_start_line_t *)arg;
+      u8g_dev_arg_start_line_t ca;
+      uint8_t r, is_done = 1;
+      for ( c = m->first->next; c != NULL; c = c->next ) {
+        ca = *a;
+        u8g_mirror_call(c, msg, &ca);
+        if (ca.is_done == 0)
+          is_done = 0;
+      }
+      r = u8g_mirror_call(m->first, msg, arg);
+      if (is_done == 0)
+        a->is_done = 0;
+      u8g_mirror_sync_range(m);
+      return r;
+    }
+    case U8G_DEV_MSG_PAGE_NEXT:
+      // all children are in the same page, the primary is transfered last, because it clears the buffer
+      for ( c = m->first->next; c != NULL; c = c->next ) {
+        u8g_mirror_copy_page(m->first, c);
+        u8g_mirror_call(c, msg, arg);
+      }
+      return u8g_mirror_call(m->first, msg, arg);
+  }
+}
+
+void u8g_InitMirrorDev(u8g_dev_t *dev, u8g_mirror_t *m) {
+  m->first = NULL;
+  dev->dev_fn = u8g_dev_mirror_fn;
+  dev->dev_mem = m;
+  dev->com_fn = NULL;
+}
+
+/*
+  Add a display to the mirror device. The first display renders, all others receive a copy.
+  Returns 0 if the geometry does not match the first display or the layouts can not be converted.
+*/
+uint8_t u8g_AddToMirror(u8g_t *m_u8g, u8g_mirror_child_t *node, u8g_t *child_u8g, uint8_t layout) {
+  u8g_mirror_t *m;
+  u8g_mirror_child_t **p;
+
+  if (m_u8g->dev->dev_fn != u8g_dev_mirror_fn)
+    return 0;   // not a mirror device
+  m = (u8g_mirror_t *)(m_u8g->dev->dev_mem);
+
+  node->next = NULL;
+  node->u8g = child_u8g;
+  node->layout = layout;
+
+  if (m->first != NULL) {
+    u8g_pb_t *a = u8g_mirror_pb(m->first);
+    u8g_pb_t *b = u8g_mirror_pb(node);
+    if (a->width != b->width || a->p.total_height != b->p.total_height || a->p.page_height != b->p.page_height)
+      return 0;
+    if (m->first->layout != layout) {
+      // conversion is available for 1 bit layouts with full 8 pixel rows
+      if (u8g_mirror_bits_per_pixel(layout) != 1 || u8g_mirror_bits_per_pixel(m->first->layout) != 1)
+        return 0;
+      if ((a->p.page_height & 7) != 0)
+        return 0;
+      if ((a->width & 7) != 0)
+        return 0;
+    }
+  }
+
+  for ( p = &(m->first); *p != NULL; p = &((*p)->next) ) { }
+  *p = node;
+
+  if (m->first == node)
+    u8g_UpdateDimension(m_u8g);
+  return 1;
+}
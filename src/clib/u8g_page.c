@@ -45,22 +45,58 @@ void u8g_page_Init(u8g_page_t *p, u8g_uint_t page_height, u8g_uint_t total_heigh
   p->page_height = page_height;
   p->total_height = total_height;
   p->page = 0;
+  u8g_page_InitStartLine(p);
   u8g_page_First(p);
 }
 
+/* no hardware scrolling, all pages in the next frame */
+void u8g_page_InitStartLine(u8g_page_t *p) {
+  p->start_page = 0;
+  p->is_range = 0;
+}
+
+/*
+  The page buffer always holds the rows page_y0..page_y1 of the visible
+  window. With a start line (hardware scrolling) these rows are stored in
+  another page of the display RAM: "page" is the page of the display RAM.
+*/
+static void u8g_page_set_ram_page(u8g_page_t *p) {
+  if (p->start_page == 0)
+    return;
+  p->page += p->start_page;
+  if ((u8g_uint_t)p->page * p->page_height >= p->total_height)
+    p->page -= p->total_height / p->page_height;
+}
+
 void u8g_page_First(u8g_page_t *p) {
+  u8g_uint_t y1;
   p->page_y0 = 0;
-  p->page_y1 = p->page_height;
-  p->page_y1--;
   p->page = 0;
+  if (p->is_range == 1) {
+    p->page = p->range_y0 / p->page_height;
+    p->page_y0 = (u8g_uint_t)p->page * p->page_height;
+  }
+  y1 = p->page_y0;
+  y1 += p->page_height;
+  y1--;
+  if (y1 >= p->total_height) {
+    y1 = p->total_height;
+    y1--;
+  }
+  p->page_y1 = y1;
+  u8g_page_set_ram_page(p);
 }
 
 uint8_t u8g_page_Next(u8g_page_t * p) {
   register u8g_uint_t y1;
   p->page_y0 += p->page_height;
-  if (p->page_y0 >= p->total_height)
+  if (p->page_y0 >= p->total_height || (p->is_range == 1 && p->page_y0 > p->range_y1)) {
+    p->is_range = 0;      // the range is valid for one frame only
     return 0;
+  }
   p->page++;
+  if (p->start_page != 0 && (u8g_uint_t)p->page * p->page_height >= p->total_height)
+    p->page = 0;
   y1 = p->page_y1;
   y1 += p->page_height;
   if (y1 >= p->total_height) {
@@ -71,3 +107,80 @@ uint8_t u8g_page_Next(u8g_page_t * p) {
 
   return 1;
 }
+
+/*
+  The next frame covers only the pages with the rows y0..y1, called by page
+  buffers for U8G_DEV_MSG_SET_FRAME_BOX. Ranges for the same frame are
+  combined.
+*/
+void u8g_page_SetRange(u8g_page_t *p, u8g_uint_t y0, u8g_uint_t y1) {
+  if (y1 >= p->total_height)
+    y1 = p->total_height - 1;
+  if (y0 > y1)
+    return;
+  if (p->is_range == 2)
+    return;
+  if (p->is_range == 1) {
+    if (p->range_y0 < y0)
+      y0 = p->range_y0;
+    if (p->range_y1 > y1)
+      y1 = p->range_y1;
+  }
+  p->is_range = 1;
+  p->range_y0 = y0;
+  p->range_y1 = y1;
+}
+
+/*
+  Hardware scrolling, called by devices for U8G_DEV_MSG_SET_START_LINE before
+  they send arg->line to the controller. The start line must be a multiple of
+  the page height. The rows which are scrolled into view are the only rows of
+  the next frame, a second scroll before this frame draws the full frame.
+  Returns 0 if the start line is not possible.
+*/
+uint8_t u8g_page_SetStartLine(u8g_page_t *p, u8g_dev_arg_start_line_t *arg) {
+  u8g_uint_t h = p->total_height;
+  u8g_uint_t old, line, delta, n;
+
+  if (h % p->page_height != 0)
+    return 0;
+  old = (u8g_uint_t)p->start_page * p->page_height;
+  if (arg->is_relative) {
+    n = arg->n < 0 ? (u8g_uint_t)-arg->n : (u8g_uint_t)arg->n;
+    n %= h;
+    line = arg->n < 0 ? old + (h - n) : old + n;
+    if (line >= h)
+      line -= h;
+  }
+  else {
+    line = arg->line;
+    if (line >= h)
+      return 0;
+  }
+  if (line % p->page_height != 0)
+    return 0;
+
+  /* content moves up by delta rows, or down by h - delta rows */
+  delta = line >= old ? line - old : line + (h - old);
+  if (delta != 0) {
+    if (p->is_range != 0) {
+      p->is_range = 2;
+    }
+    else {
+      p->is_range = 1;
+      if (delta <= h / 2) {
+        p->range_y0 = h - delta;
+        p->range_y1 = h - 1;
+      }
+      else {
+        p->range_y0 = 0;
+        p->range_y1 = h - delta - 1;
+      }
+    }
+  }
+
+  p->start_page = line / p->page_height;
+  arg->line = line;
+  arg->is_done = 1;
+  return 1;
+}
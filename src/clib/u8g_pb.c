@@ -36,14 +36,58 @@
 */
 
 #include "u8g.h"
+#include <string.h>
 
 void u8g_pb_Clear(u8g_pb_t *b) {
+  memset(b->buf, 0, b->width);
+}
+
+/*
+  Fill size bytes of the page buffer with a repeated pattern of unit (1..4) bytes,
+  taken from value, low byte first. size must be a multiple of unit.
+*/
+void u8g_pb_Fill(u8g_pb_t *b, uint16_t size, uint8_t unit, uint32_t value) {
   uint8_t *ptr = (uint8_t *)b->buf;
-  uint8_t *end_ptr = ptr;
-  end_ptr += b->width;
-  do {
-    *ptr++ = 0;
-  } while (ptr != end_ptr);
+  uint16_t n, cnt;
+  uint8_t i;
+
+  for ( i = 1; i < unit; i++ )
+    if ((uint8_t)(value >> (i * 8)) != (uint8_t)value)
+      break;
+  if (i >= unit) {
+    memset(ptr, (uint8_t)value, size);
+    return;
+  }
+
+  // store one pixel, then double the filled area with each copy
+  for ( i = 0; i < unit; i++ ) {
+    ptr[i] = (uint8_t)value;
+    value >>= 8;
+  }
+  for ( n = unit; n < size; n += cnt ) {
+    cnt = size - n;
+    if (cnt > n) cnt = n;
+    memcpy(ptr + n, ptr, cnt);
+  }
+}
+
+/*
+  Page buffer clear for U8G_DEV_MSG_PAGE_FIRST and U8G_DEV_MSG_PAGE_NEXT.
+  - opaque frame (u8g_SetOpaqueFrame): the clear is skipped
+  - frame started with u8g_FirstPageLL: the clear is deferred until the first
+    pixel (the drawing procedures of u8g_ll_api.c send U8G_DEV_MSG_CLEAR_PAGE),
+    so a first primitive which covers the page buffer (u8g_DrawBox) can skip
+    the clear
+  - otherwise (e.g. page buffer of a virtual screen child): clear now
+*/
+void u8g_pb_ClearPage(u8g_t *u8g, u8g_pb_t *b, uint16_t size, uint8_t unit) {
+  if (u8g->pb_clear & U8G_PB_CLEAR_OPAQUE)
+    return;
+  if (u8g->pb_clear & U8G_PB_CLEAR_DEFER) {
+    u8g->pb_clear |= U8G_PB_CLEAR_PENDING;
+    return;
+  }
+  u8g_pb_Fill(b, size, unit, u8g->pb_clear_value);
 }
 
 // the following procedure does not work. why? Can be checked with descpic
@@ -174,3 +218,148 @@ uint8_t u8g_pb_Is8PixelVisible(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
 uint8_t u8g_pb_WriteBuffer(u8g_pb_t *b, u8g_t *u8g, u8g_dev_t *dev) {
   return u8g_WriteSequence(u8g, dev, b->width, b->buf);
 }
+
+/*
+  8x8 bit transpose (SWAR, three swap steps on two 32 bit words)
+  rows: msb is the left pixel, cols: column c of the block, bit k is row k
+*/
+static void u8g_pb_transpose8x8(const uint8_t *rows, uint8_t *cols) {
+  uint32_t x, y, t;
+  uint8_t i;
+
+  // rows in reverse order, so that row 0 ends up in bit 0 of each column
+  x = ((uint32_t)rows[7] << 24) | ((uint32_t)rows[6] << 16) | ((uint32_t)rows[5] << 8) | rows[4];
+  y = ((uint32_t)rows[3] << 24) | ((uint32_t)rows[2] << 16) | ((uint32_t)rows[1] << 8) | rows[0];
+
+  t = (x ^ (x >> 7)) & 0x00AA00AAUL;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AAUL;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCCUL; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCCUL; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0UL) | ((y >> 4) & 0x0F0F0F0FUL);
+  y = ((x << 4) & 0xF0F0F0F0UL) | (y & 0x0F0F0F0FUL);
+  x = t;
+
+  for ( i = 0; i < 4; i++ ) {
+    cols[3 - i] = (uint8_t)x;
+    cols[7 - i] = (uint8_t)y;
+    x >>= 8;
+    y >>= 8;
+  }
+}
+
+// spread the lower 4 bits to bit 0, 2, 4 and 6
+static uint8_t u8g_pb_spread4(uint8_t v) {
+  v = (v | (v << 2)) & 0x33;
+  v = (v | (v << 1)) & 0x55;
+  return v;
+}
+
+/*
+  U8G_DEV_MSG_SET_8X8PIXEL for vertical page buffers: the block is transposed into
+  8 column bytes, which are shifted and merged into each plane of the page.
+  plane_rows: pixel rows per byte (8 for pb8v1/pb16v1, 7 for pb14v1, 4 for pb8v2/pb16v2)
+  bits_per_pixel: 1 or 2, the planes are stored one after the other, width bytes each.
+  Result is identical to 8 rows of u8g_pb8v1_Set8PixelStd() with dir 0.
+*/
+void u8g_pb_SetV8x8Pixel(u8g_pb_t *b, u8g_dev_arg_8x8_t *arg, uint8_t plane_rows, uint8_t bits_per_pixel) {
+  uint8_t cols[8];
+  uint8_t *ptr = (uint8_t *)b->buf;
+  u8g_uint_t plane_y0, d, x;
+  uint8_t i, c, plane_mask, v, m, color;
+
+  arg->is_done = 1;
+  if (arg->cnt == 0)
+    return;
+  for ( i = arg->cnt; i < 8; i++ )
+    arg->rows[i] = 0;
+  u8g_pb_transpose8x8(arg->rows, cols);
+  color = arg->color;
+  if (bits_per_pixel == 2)
+    color &= 3;
+
+  for ( plane_y0 = b->p.page_y0; plane_y0 <= b->p.page_y1; plane_y0 += plane_rows, ptr += b->width ) {
+    // rows of this plane inside the page
+    d = b->p.page_y1 - plane_y0;
+    plane_mask = d >= (u8g_uint_t)(plane_rows - 1) ? 0xff >> (8 - plane_rows) : 0xff >> (7 - d);
+
+    // vertical offset of the block inside the plane
+    d = arg->y - plane_y0;
+    i = 0;              // shift right
+    if (d >= 8) {
+      d = plane_y0 - arg->y;
+      if (d >= 8)
+        continue;
+      i = d;
+      d = 0;
+    }
+
+    for ( c = 0; c < 8; c++ ) {
+      x = arg->x + c;
+      if (x >= b->width)
+        continue;
+      v = ((cols[c] >> i) << d) & plane_mask;
+      if (v == 0)
+        continue;
+      if (bits_per_pixel == 1) {
+        if (color)
+          ptr[x] |= v;
+        else
+          ptr[x] &= ~v;
+      }
+      else {
+        v = u8g_pb_spread4(v);
+        m = v | (v << 1);
+        ptr[x] = (ptr[x] & ~m) | (v * color);
+      }
+    }
+    if ((u8g_uint_t)(plane_y0 + plane_rows) < plane_y0)
+      break;    // wrap around of u8g_uint_t
+  }
+}
+
+/*
+  Horizontal span for vertical 1 bit page buffers (pb8v1, pb16v1: 8 rows per plane, pb14v1: 7)
+  x..x+w-1 must be inside the width, y inside the current page
+*/
+void u8g_pb_SetV1Span(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color, uint8_t plane_rows) {
+  uint8_t *ptr = (uint8_t *)b->buf;
+  uint8_t row = y - b->p.page_y0;
+  uint8_t mask;
+
+  while (row >= plane_rows) {
+    row -= plane_rows;
+    ptr += b->width;
+  }
+  ptr += x;
+  mask = 1 << row;
+  if (color) {
+    do { *ptr++ |= mask; } while (--w != 0);
+  }
+  else {
+    mask = ~mask;
+    do { *ptr++ &= mask; } while (--w != 0);
+  }
+}
+
+/*
+  Four transparent pixel (U8G_DEV_MSG_SET_4TPIXEL) of the gray page buffers, the
+  two msb are the first pixel. set_tpixel gets the coverage 0..3 of one pixel in
+  arg_pixel->color, pixel without coverage are skipped. The color is restored.
+*/
+void u8g_pb_Set4TPixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel, void (*set_tpixel)(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel)) {
+  register uint8_t pixel = arg_pixel->pixel;
+  uint8_t color = arg_pixel->color;
+  do {
+    arg_pixel->color = pixel >> 6;
+    if (arg_pixel->color != 0)
+      set_tpixel(b, arg_pixel);
+    switch (arg_pixel->dir) {
+      case 0: arg_pixel->x++; break;
+      case 1: arg_pixel->y++; break;
+      case 2: arg_pixel->x--; break;
+      case 3: arg_pixel->y--; break;
+    }
+    pixel <<= 2;
+  } while (pixel != 0);
+  arg_pixel->color = color;
+}
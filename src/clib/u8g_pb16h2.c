@@ -40,16 +40,8 @@
 #include <string.h>
 
 void u8g_pb16h2_Clear(u8g_pb_t *b) {
-  uint8_t *ptr = (uint8_t *)b->buf;
-  uint8_t *end_ptr = ptr;
-
   // two bits per pixel, 16 bits height --> 8 pixel --> 4 pixel per byte
-  end_ptr += b->width;
-  end_ptr += b->width;
-
-  do {
-    *ptr++ = 0;
-  } while (ptr != end_ptr);
+  u8g_pb_Fill(b, b->width * 2, 1, 0);
 }
 
 void u8g_pb16h2_Init(u8g_pb_t *b, void *buf, u8g_uint_t width) {
@@ -114,20 +106,8 @@ void u8g_pb16h2_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   } while (pixel != 0);
 }
 
-void u8g_pb16h2_Or4PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
-  register uint8_t pixel = arg_pixel->pixel;
-  do {
-    arg_pixel->color = pixel & 0x0c0;
-    arg_pixel->color >>= 6;
-    u8g_pb16h2_SetPixel(b, arg_pixel, 1);
-    switch (arg_pixel->dir) {
-      case 0: arg_pixel->x++; break;
-      case 1: arg_pixel->y++; break;
-      case 2: arg_pixel->x--; break;
-      case 3: arg_pixel->y--; break;
-    }
-    pixel <<= 2;
-  } while (pixel != 0);
+static void u8g_pb16h2_set_tpixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) {
+  u8g_pb16h2_SetPixel(b, arg_pixel, 1);
 }
 
 uint8_t u8g_dev_pb16h2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
@@ -141,7 +121,7 @@ uint8_t u8g_dev_pb16h2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
       u8g_pb16h2_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg, 0);
       break;
     case U8G_DEV_MSG_SET_4TPIXEL:
-      u8g_pb16h2_Or4PixelStd(pb, (u8g_dev_arg_pixel_t *)arg);
+      u8g_pb_Set4TPixel(pb, (u8g_dev_arg_pixel_t *)arg, u8g_pb16h2_set_tpixel);
       break;
     case U8G_DEV_MSG_SET_TPIXEL:
       u8g_pb16h2_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg, 1);
@@ -152,20 +132,26 @@ uint8_t u8g_dev_pb16h2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
       break;
     case U8G_DEV_MSG_PAGE_FIRST:
       u8g_page_First(&(pb->p));
-      u8g_pb16h2_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2, 1);
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
       if (u8g_page_Next(&(pb->p)) == 0)
         return 0;
-      u8g_pb16h2_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2, 1);
       break;
       #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
           case U8G_DEV_MSG_IS_BBX_INTERSECTION:
             return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
       #endif
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width * 2, 1, u8g->pb_clear_value);
+      break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = pb->width;
       break;
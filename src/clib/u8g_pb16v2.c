@@ -40,16 +40,8 @@
 #include <string.h>
 
 void u8g_pb16v2_Clear(u8g_pb_t *b) {
-  uint8_t *ptr = (uint8_t *)b->buf;
-  uint8_t *end_ptr = ptr;
-
   // two bits per pixel, 16 bits height --> 8 pixel --> 4 pixel per byte
-  end_ptr += b->width;
-  end_ptr += b->width;
-
-  do {
-    *ptr++ = 0;
-  } while (ptr != end_ptr);
+  u8g_pb_Fill(b, b->width * 2, 1, 0);
 }
 
 void u8g_pb16v2Init(u8g_pb_t *b, void *buf, u8g_uint_t width) {
@@ -86,6 +78,23 @@ void u8g_pb16v2_SetPixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixe
   u8g_pb16v2_set_pixel(b, arg_pixel->x, arg_pixel->y, arg_pixel->color);
 }
 
+// transparent pixel: or the coverage 0..3 of arg_pixel->color into the pixel
+static void u8g_pb16v2_set_tpixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) {
+  uint8_t *ptr = b->buf;
+  uint8_t y;
+  if (arg_pixel->y < b->p.page_y0)
+    return;
+  if (arg_pixel->y > b->p.page_y1)
+    return;
+  if (arg_pixel->x >= b->width)
+    return;
+  y = arg_pixel->y - b->p.page_y0;
+  if (y >= 4)
+    ptr += b->width;
+  ptr += arg_pixel->x;
+  *ptr |= (arg_pixel->color & 3) << ((y & 3) << 1);
+}
+
 void u8g_pb16v2_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   register uint8_t pixel = arg_pixel->pixel;
   do {
@@ -101,6 +110,17 @@ void u8g_pb16v2_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   } while (pixel != 0);
 }
 
+static void u8g_pb16v2_set_8pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  if (u8g_pb_Is8PixelVisible(b, arg_pixel))
+    u8g_pb16v2_Set8PixelStd(b, arg_pixel);
+}
+
+static void u8g_pb16v2_set_8x8pixel(u8g_pb_t *b, u8g_dev_arg_8x8_t *arg) {
+  u8g_pb_SetV8x8Pixel(b, arg, 4, 2);
+}
+
+static const u8g_pb_fns_t u8g_pb16v2_fns = { u8g_pb16v2_SetPixel, u8g_pb16v2_set_8pixel, NULL, u8g_pb16v2_set_8x8pixel };
+
 uint8_t u8g_dev_pb16v2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
   switch (msg) {
@@ -108,29 +128,48 @@ uint8_t u8g_dev_pb16v2_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
       if (u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg))
         u8g_pb16v2_Set8PixelStd(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_8X8PIXEL:
+      u8g_pb_SetV8x8Pixel(pb, (u8g_dev_arg_8x8_t *)arg, 4, 2);
+      break;
     case U8G_DEV_MSG_SET_PIXEL:
       u8g_pb16v2_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_TPIXEL:
+      u8g_pb16v2_set_tpixel(pb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_4TPIXEL:
+      u8g_pb_Set4TPixel(pb, (u8g_dev_arg_pixel_t *)arg, u8g_pb16v2_set_tpixel);
+      break;
     case U8G_DEV_MSG_INIT:
       break;
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_FIRST:
-      u8g_pb16v2_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2, 1);
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
       if (u8g_page_Next(&(pb->p)) == 0)
         return 0;
-      u8g_pb16v2_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2, 1);
       break;
       #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
           case U8G_DEV_MSG_IS_BBX_INTERSECTION:
             return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
       #endif
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width * 2, 1, u8g->pb_clear_value);
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      ((u8g_dev_arg_pb_fns_t *)arg)->fns = &u8g_pb16v2_fns;
+      ((u8g_dev_arg_pb_fns_t *)arg)->pb = pb;
+      break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = pb->width;
       break;
@@ -44,12 +44,7 @@
 uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
 
 void u8g_pb32h1_Clear(u8g_pb_t *b) {
-  uint8_t *ptr = (uint8_t *)b->buf;
-  uint8_t *end_ptr = ptr;
-  end_ptr += b->width * 4;
-  do {
-    *ptr++ = 0;
-  } while (ptr != end_ptr);
+  u8g_pb_Fill(b, b->width * 4, 1, 0);
 }
 
 void u8g_pb32h1_Init(u8g_pb_t *b, void *buf, u8g_uint_t width) {
@@ -130,12 +125,23 @@ void u8g_pb32h1_Set8PixelOpt2(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   } while (pixel != 0);
 }
 
+static void u8g_pb32h1_set_8pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  if (u8g_pb_Is8PixelVisible(b, arg_pixel))
+    u8g_pb8h1_Set8PixelH(b, arg_pixel, 0);
+}
+
+static void u8g_pb32h1_set_span(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color) {
+  u8g_pb8h1_SetSpanH(b, x, y, w, color, 0);
+}
+
+static const u8g_pb_fns_t u8g_pb32h1_fns = { u8g_pb32h1_SetPixel, u8g_pb32h1_set_8pixel, u8g_pb32h1_set_span, NULL };
+
 uint8_t u8g_dev_pb32h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
   switch (msg) {
     case U8G_DEV_MSG_SET_8PIXEL:
       if (u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg))
-        u8g_pb32h1_Set8PixelOpt2(pb, (u8g_dev_arg_pixel_t *)arg);
+        u8g_pb8h1_Set8PixelH(pb, (u8g_dev_arg_pixel_t *)arg, 0);
       break;
     case U8G_DEV_MSG_SET_PIXEL:
       u8g_pb32h1_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
@@ -145,21 +151,31 @@ uint8_t u8g_dev_pb32h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_FIRST:
-      u8g_pb32h1_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 4, 1);
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
       if (u8g_page_Next(&(pb->p)) == 0)
         return 0;
-      u8g_pb32h1_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 4, 1);
       break;
       #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
           case U8G_DEV_MSG_IS_BBX_INTERSECTION:
             return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
       #endif
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width * 4, 1, u8g->pb_clear_value);
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      ((u8g_dev_arg_pb_fns_t *)arg)->fns = &u8g_pb32h1_fns;
+      ((u8g_dev_arg_pb_fns_t *)arg)->pb = pb;
+      break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = pb->width;
       break;
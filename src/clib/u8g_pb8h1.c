@@ -240,6 +240,124 @@ void u8g_pb8h1_Set8PixelOpt2(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   } while (pixel != 0);
 }
 
+static uint8_t u8g_pb8h1_reverse(uint8_t b) {
+  b = (b & 0xf0) >> 4 | (b & 0x0f) << 4;
+  b = (b & 0xcc) >> 2 | (b & 0x33) << 2;
+  b = (b & 0xaa) >> 1 | (b & 0x55) << 1;
+  return b;
+}
+
+static void u8g_pb8h1_write_byte(uint8_t *ptr, uint8_t mask, uint8_t color_index) {
+  if (color_index)
+    *ptr |= mask;
+  else
+    *ptr &= ~mask;
+}
+
+/* bits of the byte at x (a multiple of 8) which are inside the width of the page buffer */
+static uint8_t u8g_pb8h1_width_mask(u8g_pb_t *b, u8g_uint_t x, uint8_t is_lsb_left) {
+  u8g_uint_t n = b->width - x;
+  if (n >= 8)
+    return 0x0ff;
+  return is_lsb_left ? 0x0ff >> (8 - n) : 0x0ff << (8 - n);
+}
+
+/*
+  Set8Pixel for all horizontal 1 bit page buffers: rows of width/8 bytes, one row after
+  the other (pb8h1, pb16h1, pb32h1). is_lsb_left selects the bit order of pb8h1f.
+  dir 0 and 2: the 8 pixel are shifted into at most two bytes of one row, pixel
+  beyond the width are masked (width not a multiple of 8, e.g. st7920_202x32).
+  dir 1 and 3: a column mask is applied to the rows inside the page.
+  Pixel outside of the page buffer are clipped, x and y wrap around like in
+  u8g_pb8h1_Set8PixelStd().
+*/
+void u8g_pb8h1_Set8PixelH(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel, uint8_t is_lsb_left) {
+  uint8_t *ptr = (uint8_t *)b->buf;
+  uint8_t pixel = arg_pixel->pixel;
+  uint8_t line_len = b->width >> 3;
+  u8g_uint_t x = arg_pixel->x;
+  u8g_uint_t r = arg_pixel->y - b->p.page_y0;
+  u8g_uint_t r_max = b->p.page_y1 - b->p.page_y0;
+  uint8_t mask;
+
+  if (arg_pixel->dir & 1) {
+    // vertical: one column, up to 8 rows
+    if (x >= b->width)
+      return;
+    ptr += x >> 3;
+    mask = is_lsb_left ? 1 << (x & 7) : 0x080 >> (x & 7);
+    do {
+      if ((pixel & 128) && r <= r_max)
+        u8g_pb8h1_write_byte(ptr + (uint16_t)r * line_len, mask, arg_pixel->color);
+      if (arg_pixel->dir == 1) r++; else r--;
+      pixel <<= 1;
+    } while (pixel != 0);
+    return;
+  }
+
+  if (r > r_max)
+    return;
+  ptr += (uint16_t)r * line_len;
+
+  // dir 2 is dir 0 with reversed pixel order, starting 7 pixel left
+  if (arg_pixel->dir == 2) {
+    x -= 7;
+    pixel = u8g_pb8h1_reverse(pixel);
+  }
+  if (is_lsb_left)
+    pixel = u8g_pb8h1_reverse(pixel);
+
+  r = x & 7;        // bit position in the first byte
+  x &= ~7;
+  if (x < b->width) {
+    mask = is_lsb_left ? pixel << r : pixel >> r;
+    u8g_pb8h1_write_byte(ptr + (x >> 3), mask & u8g_pb8h1_width_mask(b, x, is_lsb_left), arg_pixel->color);
+  }
+  if (r != 0) {
+    x += 8;
+    if (x < b->width) {
+      mask = is_lsb_left ? pixel >> (8 - r) : pixel << (8 - r);
+      u8g_pb8h1_write_byte(ptr + (x >> 3), mask & u8g_pb8h1_width_mask(b, x, is_lsb_left), arg_pixel->color);
+    }
+  }
+}
+
+/*
+  Horizontal span for all horizontal 1 bit page buffers: partial first and last byte,
+  full bytes in between. x..x+w-1 must be inside the width, y inside the current page.
+*/
+void u8g_pb8h1_SetSpanH(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color, uint8_t is_lsb_left) {
+  uint8_t *ptr = (uint8_t *)b->buf;
+  uint16_t last = (uint16_t)x + w - 1;
+  uint8_t first_mask, last_mask, cnt;
+
+  ptr += (uint16_t)(y - b->p.page_y0) * (b->width >> 3);
+  ptr += x >> 3;
+  first_mask = is_lsb_left ? 0xff << (x & 7) : 0xff >> (x & 7);
+  last_mask = is_lsb_left ? 0xff >> (7 - (last & 7)) : 0xff << (7 - (last & 7));
+  cnt = (last >> 3) - (x >> 3);   // number of bytes after the first byte
+
+  if (cnt == 0) {
+    u8g_pb8h1_write_byte(ptr, first_mask & last_mask, color);
+    return;
+  }
+  u8g_pb8h1_write_byte(ptr++, first_mask, color);
+  while (--cnt != 0)
+    *ptr++ = color ? 0xff : 0x00;
+  u8g_pb8h1_write_byte(ptr, last_mask, color);
+}
+
+static void u8g_pb8h1_set_8pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  if (u8g_pb_Is8PixelVisible(b, arg_pixel))
+    u8g_pb8h1_Set8PixelH(b, arg_pixel, 0);
+}
+
+static void u8g_pb8h1_set_span(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, uint8_t color) {
+  u8g_pb8h1_SetSpanH(b, x, y, w, color, 0);
+}
+
+static const u8g_pb_fns_t u8g_pb8h1_fns = { u8g_pb8h1_SetPixel, u8g_pb8h1_set_8pixel, u8g_pb8h1_set_span, NULL };
+
 #ifdef NEW_CODE
   static void u8g_pb8h1_Set8PixelState(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
     register uint8_t pixel = arg_pixel->pixel;
@@ -303,7 +421,7 @@ uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
           u8g_pb8h1_Set8PixelState(pb, (u8g_dev_arg_pixel_t *)arg);
       #else
         if (u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg))
-          u8g_pb8h1_Set8PixelOpt2(pb, (u8g_dev_arg_pixel_t *)arg);
+          u8g_pb8h1_Set8PixelH(pb, (u8g_dev_arg_pixel_t *)arg, 0);
       #endif
       break;
     case U8G_DEV_MSG_SET_PIXEL:
@@ -314,21 +432,31 @@ uint8_t u8g_dev_pb8h1_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_FIRST:
-      u8g_pb_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width, 1);
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
       if (u8g_page_Next(&(pb->p)) == 0)
         return 0;
-      u8g_pb_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width, 1);
       break;
       #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
           case U8G_DEV_MSG_IS_BBX_INTERSECTION:
             return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
       #endif
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width, 1, u8g->pb_clear_value);
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      ((u8g_dev_arg_pb_fns_t *)arg)->fns = &u8g_pb8h1_fns;
+      ((u8g_dev_arg_pb_fns_t *)arg)->pb = pb;
+      break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = pb->width;
       break;
@@ -0,0 +1,151 @@
+/*
+
+  u8g_pb8h4.c
+
+  4 bit per pixel page buffer (16 gray levels), 2 pixel rows
+  byte has horizontal orientation, the left pixel is the high nibble
+  this is the native memory layout of SSD1322 and SSD1325, rows are sent without conversion
+
+*/
+
+#include "u8g.h"
+
+static void u8g_pb8h4_set_pixel(u8g_pb_t *b, u8g_uint_t x, u8g_uint_t y, uint8_t color_index) {
+  register uint16_t tmp;
+
+  uint8_t *ptr = b->buf;
+
+  y -= b->p.page_y0;
+
+  tmp = b->width;
+  tmp >>= 1;
+  tmp *= (uint8_t)y;
+  ptr += tmp;
+
+  tmp = x;
+  tmp >>= 1;
+  ptr += tmp;
+
+  color_index &= 15;
+  if (x & 1) {
+    *ptr &= 0x0f0;
+    *ptr |= color_index;
+  }
+  else {
+    *ptr &= 0x00f;
+    *ptr |= color_index << 4;
+  }
+}
+
+static void u8g_pb8h4_SetPixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) {
+  if (arg_pixel->y < b->p.page_y0)
+    return;
+  if (arg_pixel->y > b->p.page_y1)
+    return;
+  if (arg_pixel->x >= b->width)
+    return;
+  u8g_pb8h4_set_pixel(b, arg_pixel->x, arg_pixel->y, arg_pixel->color);
+}
+
+// transparent pixel: or the coverage 0..3 of arg_pixel->color, scaled to 0..15, into the pixel
+static void u8g_pb8h4_set_tpixel(u8g_pb_t *b, const u8g_dev_arg_pixel_t * const arg_pixel) {
+  register uint16_t tmp;
+  uint8_t *ptr = b->buf;
+  uint8_t gray;
+  if (arg_pixel->y < b->p.page_y0)
+    return;
+  if (arg_pixel->y > b->p.page_y1)
+    return;
+  if (arg_pixel->x >= b->width)
+    return;
+  tmp = b->width;
+  tmp >>= 1;
+  tmp *= (uint8_t)(arg_pixel->y - b->p.page_y0);
+  ptr += tmp;
+  ptr += arg_pixel->x >> 1;
+  gray = (arg_pixel->color & 3) * 5;
+  if (arg_pixel->x & 1)
+    *ptr |= gray;
+  else
+    *ptr |= gray << 4;
+}
+
+static void u8g_pb8h4_Set8PixelStd(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  register uint8_t pixel = arg_pixel->pixel;
+  do {
+    if (pixel & 128)
+      u8g_pb8h4_SetPixel(b, arg_pixel);
+    switch (arg_pixel->dir) {
+      case 0: arg_pixel->x++; break;
+      case 1: arg_pixel->y++; break;
+      case 2: arg_pixel->x--; break;
+      case 3: arg_pixel->y--; break;
+    }
+    pixel <<= 1;
+  } while (pixel != 0);
+}
+
+static void u8g_pb8h4_set_8pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  if (u8g_pb_Is8PixelVisible(b, arg_pixel))
+    u8g_pb8h4_Set8PixelStd(b, arg_pixel);
+}
+
+static const u8g_pb_fns_t u8g_pb8h4_fns = { u8g_pb8h4_SetPixel, u8g_pb8h4_set_8pixel, NULL, NULL };
+
+uint8_t u8g_dev_pb8h4_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+  u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
+  switch (msg) {
+    case U8G_DEV_MSG_SET_8PIXEL:
+      if (u8g_pb_Is8PixelVisible(pb, (u8g_dev_arg_pixel_t *)arg))
+        u8g_pb8h4_Set8PixelStd(pb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_PIXEL:
+      u8g_pb8h4_SetPixel(pb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_TPIXEL:
+      u8g_pb8h4_set_tpixel(pb, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_4TPIXEL:
+      u8g_pb_Set4TPixel(pb, (u8g_dev_arg_pixel_t *)arg, u8g_pb8h4_set_tpixel);
+      break;
+    case U8G_DEV_MSG_INIT:
+      break;
+    case U8G_DEV_MSG_STOP:
+      break;
+    case U8G_DEV_MSG_PAGE_FIRST:
+      u8g_pb_ClearPage(u8g, pb, pb->width, 1);
+      u8g_page_First(&(pb->p));
+      break;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      if (u8g_page_Next(&(pb->p)) == 0)
+        return 0;
+      u8g_pb_ClearPage(u8g, pb, pb->width, 1);
+      break;
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width, 1, u8g->pb_clear_value);
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      ((u8g_dev_arg_pb_fns_t *)arg)->fns = &u8g_pb8h4_fns;
+      ((u8g_dev_arg_pb_fns_t *)arg)->pb = pb;
+      break;
+    case U8G_DEV_MSG_GET_PAGE_BOX:
+      u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
+    case U8G_DEV_MSG_GET_WIDTH:
+      *((u8g_uint_t *)arg) = pb->width;
+      break;
+    case U8G_DEV_MSG_GET_HEIGHT:
+      *((u8g_uint_t *)arg) = pb->p.total_height;
+      break;
+    case U8G_DEV_MSG_SET_COLOR_ENTRY:
+      break;
+    case U8G_DEV_MSG_SET_XY_CB:
+      break;
+    case U8G_DEV_MSG_GET_MODE:
+      return U8G_MODE_GRAY4BIT;
+  }
+  return 1;
+}
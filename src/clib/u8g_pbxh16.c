@@ -42,7 +42,7 @@ struct _u8g_pb_t
 typedef struct _u8g_pb_t u8g_pb_t;
 
 uint8_t u8g_index_color_xh16_buf[2*WIDTH*PAGE_HEIGHT] U8G_NOCOMMON ;
-u8g_pb_t u8g_index_color_xh16_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0},  WIDTH, u8g_index_color_xh16_buf};
+u8g_pb_t u8g_index_color_xh16_pb = { {PAGE_HEIGHT, HEIGHT, 0, 0, 0, 0, 0, 0, 0},  WIDTH, u8g_index_color_xh16_buf};
 u8g_dev_t name = { dev_fn, &u8g_index_color_xh16_pb , com_fn }
 
 */
@@ -57,16 +57,7 @@ u8g_dev_t name = { dev_fn, &u8g_index_color_xh16_pb , com_fn }
 */
 
 void u8g_pbxh16_Clear(u8g_pb_t *b) {
-  uint8_t *ptr = (uint8_t *)b->buf;
-  uint8_t *end_ptr = ptr;
-  uint8_t cnt = b->p.page_height;
-  do {
-    end_ptr += b->width * 2;
-    cnt--;
-  } while (cnt > 0);
-  do {
-    *ptr++ = 0;
-  } while (ptr != end_ptr);
+  u8g_pb_Fill(b, b->width * 2 * b->p.page_height, 1, 0);
 }
 
 void u8g_pbxh16_Init(u8g_pb_t *b, void *buf, u8g_uint_t width) {
@@ -120,6 +111,13 @@ void u8g_pbxh16_Set8Pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
   } while (pixel != 0);
 }
 
+static void u8g_pbxh16_set_8pixel(u8g_pb_t *b, u8g_dev_arg_pixel_t *arg_pixel) {
+  if (u8g_pb_Is8PixelVisible(b, arg_pixel))
+    u8g_pbxh16_Set8Pixel(b, arg_pixel);
+}
+
+static const u8g_pb_fns_t u8g_pbxh16_fns = { u8g_pbxh16_SetPixel, u8g_pbxh16_set_8pixel, NULL, NULL };
+
 uint8_t u8g_dev_pbxh16_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
   u8g_pb_t *pb = (u8g_pb_t *)(dev->dev_mem);
   switch (msg) {
@@ -135,21 +133,31 @@ uint8_t u8g_dev_pbxh16_base_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *ar
     case U8G_DEV_MSG_STOP:
       break;
     case U8G_DEV_MSG_PAGE_FIRST:
-      u8g_pbxh16_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2 * pb->p.page_height, 2);
       u8g_page_First(&(pb->p));
       break;
     case U8G_DEV_MSG_PAGE_NEXT:
       if (u8g_page_Next(&(pb->p)) == 0)
         return 0;
-      u8g_pbxh16_Clear(pb);
+      u8g_pb_ClearPage(u8g, pb, pb->width * 2 * pb->p.page_height, 2);
       break;
       #ifdef U8G_DEV_MSG_IS_BBX_INTERSECTION
           case U8G_DEV_MSG_IS_BBX_INTERSECTION:
             return u8g_pb_IsIntersection(pb, (u8g_dev_arg_bbx_t *)arg);
       #endif
+    case U8G_DEV_MSG_CLEAR_PAGE:
+      u8g_pb_Fill(pb, pb->width * 2 * pb->p.page_height, 2, u8g->pb_clear_value);
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      ((u8g_dev_arg_pb_fns_t *)arg)->fns = &u8g_pbxh16_fns;
+      ((u8g_dev_arg_pb_fns_t *)arg)->pb = pb;
+      break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
       u8g_pb_GetPageBox(pb, (u8g_box_t *)arg);
       break;
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      u8g_page_SetRange(&(pb->p), ((u8g_box_t *)arg)->y0, ((u8g_box_t *)arg)->y1);
+      break;
     case U8G_DEV_MSG_GET_WIDTH:
       *((u8g_uint_t *)arg) = pb->width;
       break;
@@ -3,6 +3,8 @@
   u8g_polygon.c
 
   Implementation of a polygon draw algorithm for "convex" polygons.
+  u8g_InitPolygon() and u8g_FillPolygon() draw any polygon with a sorted
+  edge table.
 
   Universal 8bit Graphics Library
 
@@ -243,6 +245,124 @@ static void pg_exec(pg_struct *pg, u8g_t *u8g) {
   } while (i > 0);
 }
 
+//===========================================
+// edge table polygon algorithm
+
+/*
+  Rows y0 <= y < y1 of an edge are inside the polygon, the lower end point
+  belongs to the next edge. Pixel x of a span with x1 <= x < x2 are drawn.
+  This is the same rule as pg_exec() above.
+*/
+
+// x + ceil(dx * t / h), same rounding as pge_Next()
+static pg_word_t pg_edge_x(const u8g_poly_edge_t *e, pg_word_t y) {
+  int32_t n = (int32_t)(y - e->y0) * e->dx;
+  pg_word_t h = e->y1 - e->y0;
+  if (n >= 0)
+    return e->x0 + (pg_word_t)((n + h - 1) / h);
+  return e->x0 - (pg_word_t)(-n / h);
+}
+
+uint8_t u8g_InitPolygon(u8g_poly_t *poly, const struct pg_point_struct *points, uint16_t cnt, u8g_poly_edge_t *edges, uint8_t rule) {
+  const struct pg_point_struct *a, *b;
+  u8g_poly_edge_t e;
+  uint16_t i, j;
+
+  poly->edges = edges;
+  poly->cnt = 0;
+  poly->rule = rule;
+  for ( i = 0; i < cnt; i++ ) {
+    a = points + i;
+    b = points + (i + 1 < cnt ? i + 1 : 0);
+    if (a->y == b->y)
+      continue;
+    e.dir = 1;
+    if (a->y > b->y) {
+      a = b;
+      b = points + i;
+      e.dir = -1;
+    }
+    e.y0 = a->y;
+    e.y1 = b->y;
+    e.x0 = a->x;
+    e.dx = b->x - a->x;
+
+    // insertion sort by y0
+    for ( j = poly->cnt; j > 0 && edges[j - 1].y0 > e.y0; j-- )
+      edges[j] = edges[j - 1];
+    edges[j] = e;
+
+    if (poly->cnt == 0 || poly->max_y < e.y1)
+      poly->max_y = e.y1;
+    poly->cnt++;
+  }
+  if (poly->cnt == 0)
+    return 0;
+  poly->min_y = edges[0].y0;
+  return 1;
+}
+
+static void pg_span(u8g_t *u8g, pg_word_t x1, pg_word_t x2, pg_word_t y) {
+  if (x1 < (pg_word_t)u8g->current_page.x0)
+    x1 = u8g->current_page.x0;
+  if (x2 > (pg_word_t)u8g->current_page.x1 + 1)
+    x2 = u8g->current_page.x1 + 1;
+  if (x1 < x2)
+    u8g_draw_hline(u8g, x1, y, x2 - x1);
+}
+
+void u8g_FillPolygon(u8g_t *u8g, u8g_poly_t *poly) {
+  u8g_poly_edge_t *e, *end, *active, **pos;
+  pg_word_t y, y_end, x1;
+  int8_t winding;
+
+  if (poly->cnt == 0)
+    return;
+
+  // rows of the polygon inside the current page
+  y = u8g->current_page.y0;
+  if (y < poly->min_y)
+    y = poly->min_y;
+  y_end = (pg_word_t)u8g->current_page.y1 + 1;
+  if (y_end > poly->max_y)
+    y_end = poly->max_y;
+
+  end = poly->edges + poly->cnt;
+  for ( ; y < y_end; y++ ) {
+    // build the list of edges crossing this row, sorted by x
+    active = NULL;
+    for ( e = poly->edges; e < end && e->y0 <= y; e++ ) {
+      if (y >= e->y1)
+        continue;
+      e->x = pg_edge_x(e, y);
+      for ( pos = &active; *pos != NULL && (*pos)->x < e->x; pos = &((*pos)->next) )
+        ;
+      e->next = *pos;
+      *pos = e;
+    }
+
+    // draw the spans between the crossings
+    winding = 0;
+    x1 = 0;
+    for ( e = active; e != NULL; e = e->next ) {
+      if (poly->rule == U8G_FILL_NON_ZERO) {
+        if (winding == 0)
+          x1 = e->x;
+        winding += e->dir;
+        if (winding == 0)
+          pg_span(u8g, x1, e->x, y);
+      }
+      else {
+        if (winding == 0)
+          x1 = e->x;
+        else
+          pg_span(u8g, x1, e->x, y);
+        winding ^= 1;
+      }
+    }
+  }
+}
+
 //===========================================
 // API procedures
 
@@ -251,6 +371,7 @@ void pg_ClearPolygonXY(pg_struct *pg) {
 }
 
 void pg_AddPolygonXY(pg_struct *pg, u8g_t *u8g, int16_t x, int16_t y) {
+  (void)u8g;
   if (pg->cnt < PG_MAX_POINTS) {
     pg->list[pg->cnt].x = x;
     pg->list[pg->cnt].y = y;
@@ -279,9 +400,16 @@ void u8g_DrawPolygon(u8g_t *u8g) {
 }
 
 void u8g_DrawTriangle(u8g_t *u8g, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
-  u8g_ClearPolygonXY();
-  u8g_AddPolygonXY(u8g, x0, y0);
-  u8g_AddPolygonXY(u8g, x1, y1);
-  u8g_AddPolygonXY(u8g, x2, y2);
-  u8g_DrawPolygon(u8g);
+  struct pg_point_struct list[3];
+  u8g_poly_edge_t edges[3];
+  u8g_poly_t poly;
+
+  list[0].x = x0;
+  list[0].y = y0;
+  list[1].x = x1;
+  list[1].y = y1;
+  list[2].x = x2;
+  list[2].y = y2;
+  if (u8g_InitPolygon(&poly, list, 3, edges, U8G_FILL_EVEN_ODD))
+    u8g_FillPolygon(u8g, &poly);
 }
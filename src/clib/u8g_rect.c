@@ -37,8 +37,39 @@
 
 #include "u8g.h"
 
+/*
+  Direct page buffer span: clip against the page, the line may continue behind
+  the wrap around of u8g_uint_t
+*/
+static void u8g_draw_hspan(u8g_t *u8g, u8g_pb_t *pb, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w) {
+  u8g_uint_t n;
+
+  if (y < pb->p.page_y0 || y > pb->p.page_y1)
+    return;
+  while (w != 0) {
+    if (x < pb->width) {
+      n = pb->width - x;
+      if (n > w)
+        n = w;
+      u8g->pb_fns->set_span(pb, x, y, n, u8g->arg_pixel.color);
+    }
+    if (x == 0)
+      break;
+    n = (u8g_uint_t)(0 - x);    // pixel until the wrap around
+    if (w <= n)
+      break;
+    w -= n;
+    x = 0;
+  }
+}
+
 void u8g_draw_hline(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w) {
   uint8_t pixel = 0x0ff;
+  u8g_pb_t *pb = u8g_get_direct_pb(u8g);
+  if (pb != NULL && u8g->pb_fns->set_span != NULL) {
+    u8g_draw_hspan(u8g, pb, x, y, w);
+    return;
+  }
   while (w >= 8) {
     u8g_Draw8Pixel(u8g, x, y, 0, pixel);
     w -= 8;
@@ -104,10 +135,30 @@ void u8g_draw_box(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint
   } while (h != 0);
 }
 
+/*
+  A box which covers the page buffer overwrites all pixels: a deferred page
+  buffer clear is not required. The current page is the box of the page
+  buffer only if the direct fast path is available: with a transformation
+  (e.g. scaling with a remainder) the box may miss some device rows.
+*/
+static void u8g_box_cancel_clear(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
+  u8g_uint_t x1 = x + w - 1;
+  u8g_uint_t y1 = y + h - 1;
+  if (u8g->pb_fns == NULL)
+    return;
+  if (x > u8g->current_page.x0 || x1 < u8g->current_page.x1 || x1 < x)
+    return;
+  if (y > u8g->current_page.y0 || y1 < u8g->current_page.y1 || y1 < y)
+    return;
+  u8g->pb_clear &= ~U8G_PB_CLEAR_PENDING;
+}
+
 // restrictions: h > 0
 void u8g_DrawBox(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
   if (u8g_IsBBXIntersection(u8g, x, y, w, h) == 0)
     return;
+  if (u8g->pb_clear & U8G_PB_CLEAR_PENDING)
+    u8g_box_cancel_clear(u8g, x, y, w, h);
   u8g_draw_box(u8g, x, y, w, h);
 }
 
@@ -0,0 +1,98 @@
+/*
+
+  u8g_sprite.c
+
+  Sprites: bitmaps with a transparency mask, drawn in one call. Set pixel of
+  the mask are written, either with the current color (image pixel set) or
+  with the background color (image pixel clear). Pixel outside of the mask
+  keep the content of the page.
+
+  Atlas: all sprites of an atlas have the same size, e.g. the frames of an
+  animated icon
+    offset
+      0   cnt: bytes per row
+      1   h: number of rows
+      2   number of sprites
+      3   sprite 0: cnt*h bytes image, cnt*h bytes mask
+      ... sprite 1, ...
+  Rows are stored like u8g_DrawBitmapP(): cnt bytes per row, msb is the left
+  pixel.
+
+  u8g_SetSprite() looks up the sprite and keeps it together with the
+  position, u8g_DrawSprite() only clips the rows to the current page.
+
+*/
+
+#include "u8g.h"
+
+#define U8G_SPRITE_ATLAS_HEADER 3
+
+uint8_t u8g_GetAtlasSpriteCnt(const u8g_pgm_uint8_t *atlas) {
+  return u8g_pgm_read(atlas + 2);
+}
+
+void u8g_SetSprite(u8g_sprite_t *sprite, const u8g_pgm_uint8_t *atlas, uint8_t idx, u8g_uint_t x, u8g_uint_t y) {
+  uint16_t size;
+  sprite->cnt = u8g_pgm_read(atlas);
+  sprite->h = u8g_pgm_read(atlas + 1);
+  size = (uint16_t)sprite->cnt * sprite->h;
+  sprite->image = atlas + U8G_SPRITE_ATLAS_HEADER + (uint32_t)size * 2 * idx;
+  sprite->mask = sprite->image + size;
+  sprite->x = x;
+  sprite->y = y;
+}
+
+void u8g_MoveSprite(u8g_sprite_t *sprite, u8g_uint_t x, u8g_uint_t y) {
+  sprite->x = x;
+  sprite->y = y;
+}
+
+void u8g_DrawSprite(u8g_t *u8g, const u8g_sprite_t *sprite) {
+  u8g_uint_t r_first, r_last, x, y;
+  const u8g_pgm_uint8_t *image;
+  const u8g_pgm_uint8_t *mask;
+  uint8_t i, b, m, fg, fg_hi;
+
+  if (sprite->cnt == 0 || sprite->h == 0)
+    return;
+  if (u8g_IsBBXIntersection(u8g, sprite->x, sprite->y, (u8g_uint_t)sprite->cnt * 8, sprite->h) == 0)
+    return;
+
+  /* slice of the sprite inside the current page */
+  if (u8g_GetPageRows(u8g, sprite->y, sprite->h, &r_first, &r_last) == 0)
+    return;
+
+  fg = u8g->arg_pixel.color;
+  fg_hi = u8g->arg_pixel.hi_color;
+  image = sprite->image + (uint16_t)r_first * sprite->cnt;
+  mask = sprite->mask + (uint16_t)r_first * sprite->cnt;
+  y = sprite->y + r_first;
+  for ( ;; ) {
+    x = sprite->x;
+    for ( i = 0; i < sprite->cnt; i++ ) {
+      m = u8g_pgm_read(mask + i);
+      if (m != 0) {
+        b = u8g_pgm_read(image + i);
+        if ((b & m) != 0) {
+          u8g->arg_pixel.color = fg;
+          u8g->arg_pixel.hi_color = fg_hi;
+          u8g_Draw8Pixel(u8g, x, y, 0, b & m);
+        }
+        if ((~b & m) != 0) {
+          u8g->arg_pixel.color = u8g_GetDefaultBackgroundColor(u8g);
+          u8g->arg_pixel.hi_color = 0;
+          u8g_Draw8Pixel(u8g, x, y, 0, ~b & m);
+        }
+      }
+      x += 8;
+    }
+    if (r_first == r_last)
+      break;
+    r_first++;
+    y++;
+    image += sprite->cnt;
+    mask += sprite->cnt;
+  }
+  u8g->arg_pixel.color = fg;
+  u8g->arg_pixel.hi_color = fg_hi;
+}
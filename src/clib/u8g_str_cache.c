@@ -0,0 +1,293 @@
+/*
+
+  u8g_str_cache.c
+
+  String cache: u8g_DrawStr() rasterizes a string once into a 1 bit bitmap
+  (horizontal bytes, msb is the left pixel) and draws the bitmap afterwards.
+
+  The cache lives in an arena of the caller, see u8g_SetStrCache(). An entry
+  is found by font and string, the bitmap is a mask and drawn with the
+  current color. If the arena is full, the least recently used entries are
+  removed. On each page only the rows of the bitmap inside the page are drawn.
+
+  Arena:
+    u8g_str_cache_t, followed by the entries
+  Entry:
+    u8g_str_cache_entry_t, the string (without '\0'), the bitmap
+
+*/
+
+#include "u8g.h"
+#include <string.h>
+
+#define U8G_STR_CACHE_ALIGN(n) (((n) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+typedef struct _u8g_str_cache_t {
+  uint16_t used;                /* bytes of all entries */
+  uint16_t tick;                /* incremented with each lookup */
+} u8g_str_cache_t;
+
+typedef struct _u8g_str_cache_entry_t {
+  const u8g_fntpgm_uint8_t *font;
+  uint16_t size;                /* bytes of the complete entry */
+  uint16_t stamp;               /* tick of the last use */
+  uint16_t hash;
+  u8g_uint_t width;             /* return value of u8g_DrawStr() */
+  int16_t x, y;                 /* upper left corner of the bitmap relative to the reference point */
+  uint8_t len;                  /* length of the string */
+  uint8_t cnt;                  /* bytes per row */
+  uint8_t h;                    /* number of rows */
+} u8g_str_cache_entry_t;
+
+#define U8G_STR_CACHE_HEADER U8G_STR_CACHE_ALIGN(sizeof(u8g_str_cache_t))
+#define U8G_STR_CACHE_ENTRY U8G_STR_CACHE_ALIGN(sizeof(u8g_str_cache_entry_t))
+
+static u8g_str_cache_t *u8g_str_cache_get(u8g_t *u8g) {
+  return (u8g_str_cache_t *)u8g->str_cache;
+}
+
+static uint8_t *u8g_str_cache_entries(u8g_t *u8g) {
+  return (uint8_t *)u8g->str_cache + U8G_STR_CACHE_HEADER;
+}
+
+void u8g_SetStrCache(u8g_t *u8g, void *mem, uint16_t size) {
+  if (mem == NULL || size <= U8G_STR_CACHE_HEADER + U8G_STR_CACHE_ENTRY) {
+    u8g->str_cache = NULL;
+    u8g->str_cache_size = 0;
+    return;
+  }
+  u8g->str_cache = mem;
+  u8g->str_cache_size = size - U8G_STR_CACHE_HEADER;
+  u8g_ClearStrCache(u8g);
+}
+
+void u8g_ClearStrCache(u8g_t *u8g) {
+  if (u8g->str_cache == NULL)
+    return;
+  u8g_str_cache_get(u8g)->used = 0;
+  u8g_str_cache_get(u8g)->tick = 0;
+}
+
+/* length and hash of the string, 0 if the string is too long */
+static uint8_t u8g_str_cache_hash(const char *s, uint16_t *hash) {
+  uint16_t h = 5381;
+  uint8_t len = 0;
+  while (*s != '\0') {
+    if (len == 255)
+      return 0;
+    h = (h << 5) + h + (uint8_t)*s;
+    s++;
+    len++;
+  }
+  *hash = h;
+  return len;
+}
+
+static u8g_str_cache_entry_t *u8g_str_cache_find(u8g_t *u8g, const char *s, uint8_t len, uint16_t hash) {
+  uint8_t *ptr = u8g_str_cache_entries(u8g);
+  uint8_t *end = ptr + u8g_str_cache_get(u8g)->used;
+  u8g_str_cache_entry_t *e;
+
+  while (ptr < end) {
+    e = (u8g_str_cache_entry_t *)ptr;
+    if (e->hash == hash && e->len == len && e->font == u8g->font && memcmp(ptr + U8G_STR_CACHE_ENTRY, s, len) == 0)
+      return e;
+    ptr += e->size;
+  }
+  return NULL;
+}
+
+/* remove the least recently used entry */
+static void u8g_str_cache_remove_lru(u8g_t *u8g) {
+  u8g_str_cache_t *cache = u8g_str_cache_get(u8g);
+  uint8_t *ptr = u8g_str_cache_entries(u8g);
+  uint8_t *end = ptr + cache->used;
+  uint8_t *lru = ptr;
+  uint16_t size;
+
+  while (ptr < end) {
+    if ((uint16_t)(cache->tick - ((u8g_str_cache_entry_t *)ptr)->stamp) > (uint16_t)(cache->tick - ((u8g_str_cache_entry_t *)lru)->stamp))
+      lru = ptr;
+    ptr += ((u8g_str_cache_entry_t *)ptr)->size;
+  }
+  size = ((u8g_str_cache_entry_t *)lru)->size;
+  memmove(lru, lru + size, end - lru - size);
+  cache->used -= size;
+}
+
+/*
+  Draw the string with the glyph procedures into a pb8h1 page buffer on top of
+  the bitmap, (x, y) is the reference point inside the bitmap.
+*/
+static void u8g_str_cache_raster(u8g_t *u8g, const char *s, u8g_uint_t x, u8g_uint_t y, uint8_t *bitmap, uint8_t cnt, uint8_t h) {
+  u8g_pb_t pb;
+  u8g_dev_t dev;
+  u8g_dev_t *save_dev = u8g->dev;
+  u8g_box_t save_page = u8g->current_page;
+  const u8g_pb_fns_t *save_pb_fns = u8g->pb_fns;
+  uint8_t save_dev_caps = u8g->dev_caps;
+  uint8_t save_pb_clear = u8g->pb_clear;
+  u8g_dev_arg_pixel_t save_arg_pixel = u8g->arg_pixel;
+  uint16_t encoding;
+
+  memset(bitmap, 0, (uint16_t)cnt * h);
+  u8g_page_Init(&pb.p, h, h);     // one page: rows 0..h-1, no start line, no range
+  pb.width = cnt * 8;
+  pb.buf = bitmap;
+  dev.dev_fn = u8g_dev_pb8h1_base_fn;
+  dev.dev_mem = &pb;
+  dev.com_fn = u8g_com_null_fn;
+
+  u8g->dev = &dev;
+  u8g->current_page.x0 = 0;
+  u8g->current_page.y0 = 0;
+  u8g->current_page.x1 = pb.width - 1;
+  u8g->current_page.y1 = h - 1;
+  u8g->pb_fns = NULL;
+  u8g->dev_caps = 0;
+  u8g->pb_clear = 0;
+  u8g->arg_pixel.color = 1;
+
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &s, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    x += u8g_draw_glyph16(u8g, x, y, encoding);
+  }
+
+  u8g->dev = save_dev;
+  u8g->current_page = save_page;
+  u8g->pb_fns = save_pb_fns;
+  u8g->dev_caps = save_dev_caps;
+  u8g->pb_clear = save_pb_clear;
+  u8g->arg_pixel = save_arg_pixel;
+}
+
+/* rasterize the string into a new entry, NULL if it does not fit into the cache */
+static u8g_str_cache_entry_t *u8g_str_cache_add(u8g_t *u8g, const char *s, uint8_t len, uint16_t hash) {
+  u8g_str_cache_t *cache = u8g_str_cache_get(u8g);
+  u8g_str_cache_entry_t *e;
+  const char *t = s;
+  uint16_t encoding;
+  uint32_t size;
+  int16_t pos = 0, x0 = 0x7fff, x1 = -0x7fff, y0 = 0x7fff, y1 = -0x7fff;
+  uint8_t cnt = 0, h = 0;
+  u8g_uint_t width = 0;
+
+  // extent of the pixels relative to the reference point, same positions as u8g_draw_glyph16()
+  for (;;) {
+    encoding = u8g_font_next_encoding(u8g, &t, u8g_font_get_char);
+    if (encoding == 0)
+      break;
+    if (u8g_IsGlyph16(u8g, encoding) == 0)
+      continue;
+    if (u8g->glyph_width > 0 && u8g->glyph_height > 0) {
+      if (x0 > pos + u8g->glyph_x)
+        x0 = pos + u8g->glyph_x;
+      if (x1 < pos + u8g->glyph_x + u8g->glyph_width - 1)
+        x1 = pos + u8g->glyph_x + u8g->glyph_width - 1;
+      if (y0 > -u8g->glyph_y - u8g->glyph_height)
+        y0 = -u8g->glyph_y - u8g->glyph_height;
+      if (y1 < -u8g->glyph_y - 1)
+        y1 = -u8g->glyph_y - 1;
+    }
+    pos += u8g->glyph_dx;
+    width += u8g->glyph_dx;
+  }
+
+  if (x0 <= x1) {
+    if (x1 - x0 + 1 > 255 * 8 || y1 - y0 + 1 > 255)
+      return NULL;
+    cnt = (x1 - x0 + 8) / 8;
+    h = y1 - y0 + 1;
+    if ((uint16_t)cnt * 8 - 1 > (u8g_uint_t)~(u8g_uint_t)0)
+      return NULL;
+  }
+
+  size = U8G_STR_CACHE_ALIGN(U8G_STR_CACHE_ENTRY + len + (uint32_t)cnt * h);
+  if (size > u8g->str_cache_size)
+    return NULL;
+  while (cache->used + size > u8g->str_cache_size)
+    u8g_str_cache_remove_lru(u8g);
+
+  e = (u8g_str_cache_entry_t *)(u8g_str_cache_entries(u8g) + cache->used);
+  cache->used += size;
+  e->font = u8g->font;
+  e->size = size;
+  e->hash = hash;
+  e->width = width;
+  e->x = x0;
+  e->y = y0;
+  e->len = len;
+  e->cnt = cnt;
+  e->h = h;
+  memcpy((uint8_t *)e + U8G_STR_CACHE_ENTRY, s, len);
+  if (cnt > 0)
+    u8g_str_cache_raster(u8g, s, -x0, -y0, (uint8_t *)e + U8G_STR_CACHE_ENTRY + len, cnt, h);
+  return e;
+}
+
+/*
+  Used by u8g_DrawStr(): draw the string from the cache, (x, y) is the reference point
+  after the vertical adjustment. Returns 0 if the string is not cached and can not be
+  added, the caller draws it glyph by glyph then.
+*/
+uint8_t u8g_draw_str_cached(u8g_t *u8g, u8g_uint_t x, u8g_uint_t y, const char *s, u8g_uint_t *width) {
+  u8g_str_cache_entry_t *e;
+  uint16_t hash;
+  uint8_t len;
+  u8g_uint_t r, r_first, r_last, c_first, c_last;
+  const uint8_t *bitmap;
+
+  if (u8g->font == NULL || u8g_pgm_read(u8g->font) == 2)
+    return 0;     // anti aliased fonts are drawn with u8g_DrawAAStr()
+
+  len = u8g_str_cache_hash(s, &hash);
+  if (len == 0)
+    return 0;
+
+  u8g_str_cache_get(u8g)->tick++;
+  e = u8g_str_cache_find(u8g, s, len, hash);
+  if (e == NULL) {
+    e = u8g_str_cache_add(u8g, s, len, hash);
+    if (e == NULL)
+      return 0;
+  }
+  e->stamp = u8g_str_cache_get(u8g)->tick;
+
+  x += e->x;
+  y += e->y;
+  if (e->cnt > 0 && ((u8g_uint_t)(x + e->cnt * 8 - 1) < x || (u8g_uint_t)(y + e->h - 1) < y))
+    return 0;                 // wraps around (negative position): glyphs clip on their own
+
+  *width = e->width;
+  if (e->cnt == 0)
+    return 1;
+  if (u8g_IsBBXIntersection(u8g, x, y, e->cnt * 8, e->h) == 0)
+    return 1;
+
+  // rows and bytes of the bitmap inside the current page
+  if (u8g_GetPageRows(u8g, y, e->h, &r_first, &r_last) == 0)
+    return 1;
+  c_first = u8g->current_page.x0 - x;
+  c_last = u8g->current_page.x1 - x;
+  if (c_first > c_last)
+    c_first = 0;
+  c_first /= 8;
+  c_last /= 8;
+  if (c_last >= e->cnt)
+    c_last = e->cnt - 1;
+
+  bitmap = (uint8_t *)e + U8G_STR_CACHE_ENTRY + e->len + (uint16_t)r_first * e->cnt;
+  if (c_first == 0 && c_last == e->cnt - 1) {
+    u8g_draw_bitmap_rows(u8g, x, y + r_first, e->cnt, r_last - r_first + 1, bitmap, 0);
+    return 1;
+  }
+
+  // partly outside of the display, bytes beyond the edge might wrap around
+  for ( r = r_first; r <= r_last; r++ ) {
+    u8g_DrawHBitmap(u8g, x + c_first * 8, y + r, c_last - c_first + 1, bitmap + c_first);
+    bitmap += e->cnt;
+  }
+  return 1;
+}
@@ -0,0 +1,448 @@
+/*
+
+  u8g_transform.c
+
+  Single device stage for translation, integer scale, mirror and 90 degree rotation.
+  u8g_rot.c and u8g_scale.c configure this stage, no further devices are stacked.
+
+  A user pixel (x,y) is mapped in this order:
+    1. translation: (x+tx, y+ty)
+    2. scale: block of sx * sy pixel at ((x+tx)*sx, (y+ty)*sy)
+    3. flip and rotation: one of the eight axis permutations, described by
+       swap (exchange x and y), negx and negy (count from right/bottom edge)
+
+  The permutation and the size of the next device are calculated once per page
+  (U8G_DEV_MSG_GET_PAGE_BOX). All arithmetic is modulo u8g_uint_t like in the
+  rest of u8glib, so negative coordinates still wrap into the page as before.
+
+*/
+
+#include "u8g.h"
+
+uint8_t u8g_dev_xform_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg);
+
+u8g_dev_t u8g_dev_xform = { u8g_dev_xform_fn, NULL, NULL };
+
+struct _u8g_xform_t {
+  // configuration
+  uint8_t rot;          // 0..3: 0, 90, 180, 270 degree
+  uint8_t flip;         // U8G_FLIP_X, U8G_FLIP_Y
+  uint8_t sx, sy;
+  u8g_uint_t tx, ty;
+
+  // derived values, see u8g_xform_update()
+  uint8_t swap, negx, negy;
+  uint8_t dir[4];       // device direction for a user direction
+  u8g_uint_t dev_w, dev_h;
+  u8g_uint_t page_y0, page_y1;
+};
+typedef struct _u8g_xform_t u8g_xform_t;
+
+static u8g_xform_t u8g_xform = { 0, 0, 1, 1, 0, 0, 0, 0, 0, { 0, 1, 2, 3 }, 0, 0, 0, (u8g_uint_t)-1 };
+
+/*
+  Expansion of a nibble to 4*factor bits, high byte first.
+  Row 0 is factor 2, row 1 is factor 3 and row 2 is factor 4.
+*/
+static const uint8_t u8g_xform_lut[3][32] PROGMEM = {
+  { 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x30, 0x00, 0x33, 0x00, 0x3c, 0x00, 0x3f,
+    0x00, 0xc0, 0x00, 0xc3, 0x00, 0xcc, 0x00, 0xcf, 0x00, 0xf0, 0x00, 0xf3, 0x00, 0xfc, 0x00, 0xff },
+  { 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x00, 0x3f, 0x01, 0xc0, 0x01, 0xc7, 0x01, 0xf8, 0x01, 0xff,
+    0x0e, 0x00, 0x0e, 0x07, 0x0e, 0x38, 0x0e, 0x3f, 0x0f, 0xc0, 0x0f, 0xc7, 0x0f, 0xf8, 0x0f, 0xff },
+  { 0x00, 0x00, 0x00, 0x0f, 0x00, 0xf0, 0x00, 0xff, 0x0f, 0x00, 0x0f, 0x0f, 0x0f, 0xf0, 0x0f, 0xff,
+    0xf0, 0x00, 0xf0, 0x0f, 0xf0, 0xf0, 0xf0, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xf0, 0xff, 0xff }
+};
+
+static uint16_t u8g_xform_nibble(uint8_t factor, uint8_t nibble) {
+  const uint8_t *p = &(u8g_xform_lut[factor - 2][nibble * 2]);
+  uint16_t v = u8g_pgm_read(p);
+  v <<= 8;
+  v |= u8g_pgm_read(p + 1);
+  return v;
+}
+
+/*
+  Expand the 8 pixel pattern to 8*factor pixel. The first pixel is the msb of the result.
+  The result is stored in "factor" bytes, first byte goes to the lowest position in "out".
+*/
+static void u8g_xform_expand(uint8_t pixel, uint8_t factor, uint8_t *out) {
+  uint32_t v;
+  if (factor == 1) {
+    out[0] = pixel;
+    return;
+  }
+  v = u8g_xform_nibble(factor, pixel >> 4);
+  v <<= 4 * factor;
+  v |= u8g_xform_nibble(factor, pixel & 15);
+  do {
+    factor--;
+    out[factor] = v & 255;
+    v >>= 8;
+  } while (factor > 0);
+}
+
+//====================================================================
+
+static void u8g_xform_update(u8g_xform_t *t) {
+  static const uint8_t rot_swap = 0x0a, rot_negx = 0x06, rot_negy = 0x0c;  // bit n: value for rotation n
+  uint8_t d;
+  int8_t vx, vy, tmp;
+
+  t->swap = (rot_swap >> t->rot) & 1;
+  t->negx = (rot_negx >> t->rot) & 1;
+  t->negy = (rot_negy >> t->rot) & 1;
+
+  // mirror the user picture: flip the device axis, which receives the user axis
+  if (t->flip & U8G_FLIP_X) {
+    if (t->swap) t->negy ^= 1; else t->negx ^= 1;
+  }
+  if (t->flip & U8G_FLIP_Y) {
+    if (t->swap) t->negx ^= 1; else t->negy ^= 1;
+  }
+
+  for ( d = 0; d < 4; d++ ) {
+    vx = d == 0 ? 1 : d == 2 ? -1 : 0;
+    vy = d == 1 ? 1 : d == 3 ? -1 : 0;
+    if (t->swap) { tmp = vx; vx = vy; vy = tmp; }
+    if (t->negx) vx = -vx;
+    if (t->negy) vy = -vy;
+    t->dir[d] = vx > 0 ? 0 : vy > 0 ? 1 : vx < 0 ? 2 : 3;
+  }
+}
+
+static void u8g_xform_apply(u8g_t *u8g) {
+  u8g_xform_t *t = &u8g_xform;
+  uint8_t is_identity = t->rot == 0 && t->flip == 0 && t->sx == 1 && t->sy == 1 && t->tx == 0 && t->ty == 0;
+
+  if (is_identity) {
+    if (u8g->dev == &u8g_dev_xform)
+      u8g->dev = u8g_dev_xform.dev_mem;
+  }
+  else if (u8g->dev != &u8g_dev_xform) {
+    u8g_dev_xform.dev_mem = u8g->dev;
+    u8g->dev = &u8g_dev_xform;
+  }
+
+  u8g_xform_update(t);
+  if (u8g->dev == &u8g_dev_xform) {
+    t->dev_w = u8g_GetWidthLL(u8g, (u8g_dev_t *)u8g_dev_xform.dev_mem);
+    t->dev_h = u8g_GetHeightLL(u8g, (u8g_dev_t *)u8g_dev_xform.dev_mem);
+  }
+  t->page_y0 = 0;
+  t->page_y1 = (u8g_uint_t)-1;
+  u8g_UpdateDimension(u8g);
+}
+
+static void u8g_xform_reset(u8g_xform_t *t) {
+  t->rot = 0;
+  t->flip = 0;
+  t->sx = 1;
+  t->sy = 1;
+  t->tx = 0;
+  t->ty = 0;
+}
+
+/*
+  There is only one transformation stage: a u8g without this stage (e.g. after
+  u8g_Init()) starts with the identity, not with the settings of the last u8g.
+*/
+static u8g_xform_t *u8g_xform_get(u8g_t *u8g) {
+  if (u8g->dev != &u8g_dev_xform)
+    u8g_xform_reset(&u8g_xform);
+  return &u8g_xform;
+}
+
+/* rot: 0..3 for 0, 90, 180 and 270 degree (clockwise) */
+void u8g_SetRotation(u8g_t *u8g, uint8_t rot) {
+  u8g_xform_get(u8g)->rot = rot & 3;
+  u8g_xform_apply(u8g);
+}
+
+/* sx, sy: integer scale factors between 1 and U8G_SCALE_MAX */
+void u8g_SetScale(u8g_t *u8g, uint8_t sx, uint8_t sy) {
+  u8g_xform_t *t;
+  if (sx < 1) sx = 1;
+  if (sx > U8G_SCALE_MAX) sx = U8G_SCALE_MAX;
+  if (sy < 1) sy = 1;
+  if (sy > U8G_SCALE_MAX) sy = U8G_SCALE_MAX;
+  t = u8g_xform_get(u8g);
+  t->sx = sx;
+  t->sy = sy;
+  u8g_xform_apply(u8g);
+}
+
+/* flip: combination of U8G_FLIP_X and U8G_FLIP_Y, mirrors the picture before rotation */
+void u8g_SetFlip(u8g_t *u8g, uint8_t flip) {
+  u8g_xform_get(u8g)->flip = flip & (U8G_FLIP_X | U8G_FLIP_Y);
+  u8g_xform_apply(u8g);
+}
+
+/* move the picture by dx, dy (user pixel, before scaling) */
+void u8g_SetTranslation(u8g_t *u8g, u8g_uint_t dx, u8g_uint_t dy) {
+  u8g_xform_t *t = u8g_xform_get(u8g);
+  t->tx = dx;
+  t->ty = dy;
+  u8g_xform_apply(u8g);
+}
+
+void u8g_UndoTransform(u8g_t *u8g) {
+  u8g_xform_reset(&u8g_xform);
+  u8g_xform_apply(u8g);
+}
+
+//====================================================================
+
+// map a point of the scaled user space to the next device
+static void u8g_xform_map(const u8g_xform_t *t, u8g_uint_t xs, u8g_uint_t ys, u8g_dev_arg_pixel_t *arg) {
+  u8g_uint_t a, b;
+  if (t->swap) { a = ys; b = xs; }
+  else { a = xs; b = ys; }
+  if (t->negx) a = t->dev_w - 1 - a;
+  if (t->negy) b = t->dev_h - 1 - b;
+  arg->x = a;
+  arg->y = b;
+}
+
+static void u8g_xform_8pixel(u8g_t *u8g, u8g_dev_t *chain, const u8g_xform_t *t, u8g_dev_arg_pixel_t *arg, u8g_uint_t xs, u8g_uint_t ys, uint8_t dir, uint8_t pixel) {
+  u8g_xform_map(t, xs, ys, arg);
+  dir = t->dir[dir];
+  if ((dir & 1) == 0) {
+    if (arg->y < t->page_y0 || arg->y > t->page_y1)
+      return;
+  }
+  else {
+    u8g_uint_t y0 = arg->y, y1 = arg->y;
+    if (dir == 1) y1 += 7; else y0 -= 7;
+    if (y0 <= y1 && (y1 < t->page_y0 || y0 > t->page_y1))
+      return;
+  }
+  arg->dir = dir;
+  arg->pixel = pixel;
+  u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_8PIXEL, arg);
+}
+
+// top left corner of the device block for the user pixel
+static void u8g_xform_block(const u8g_xform_t *t, u8g_uint_t x, u8g_uint_t y, u8g_dev_arg_pixel_t *arg) {
+  u8g_uint_t xs = (u8g_uint_t)(x + t->tx) * t->sx;
+  u8g_uint_t ys = (u8g_uint_t)(y + t->ty) * t->sy;
+  uint8_t cx, cy;
+  if (t->swap) { cx = t->negy; cy = t->negx; }
+  else { cx = t->negx; cy = t->negy; }
+  if (cx) xs += t->sx - 1;
+  if (cy) ys += t->sy - 1;
+  u8g_xform_map(t, xs, ys, arg);
+}
+
+static void u8g_xform_pixel(u8g_t *u8g, u8g_dev_t *chain, const u8g_xform_t *t, u8g_dev_arg_pixel_t *arg) {
+  u8g_uint_t x, y;
+  uint8_t bw, bh, i;
+
+  u8g_xform_block(t, arg->x, arg->y, arg);
+  if (t->sx == 1 && t->sy == 1) {
+    u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_PIXEL, arg);
+    return;
+  }
+
+  bw = t->swap ? t->sy : t->sx;
+  bh = t->swap ? t->sx : t->sy;
+  x = arg->x;
+  y = arg->y;
+  if (bw >= bh) {
+    for ( i = 0; i < bh; i++, y++ ) {
+      if (y < t->page_y0 || y > t->page_y1)
+        continue;
+      arg->x = x;
+      arg->y = y;
+      arg->dir = 0;
+      arg->pixel = (uint8_t)(0xff00 >> bw);
+      u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_8PIXEL, arg);
+    }
+  }
+  else {
+    for ( i = 0; i < bw; i++, x++ ) {
+      arg->x = x;
+      arg->y = y;
+      arg->dir = 1;
+      arg->pixel = (uint8_t)(0xff00 >> bh);
+      u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_8PIXEL, arg);
+    }
+  }
+}
+
+// transparent pixel: there is no run message, send each pixel of the block
+static void u8g_xform_tpixel(u8g_t *u8g, u8g_dev_t *chain, const u8g_xform_t *t, u8g_dev_arg_pixel_t *arg) {
+  u8g_uint_t x, y;
+  uint8_t bw, bh, i, j;
+
+  u8g_xform_block(t, arg->x, arg->y, arg);
+  bw = t->swap ? t->sy : t->sx;
+  bh = t->swap ? t->sx : t->sy;
+  x = arg->x;
+  y = arg->y;
+  for ( j = 0; j < bh; j++ )
+    for ( i = 0; i < bw; i++ ) {
+      arg->x = x + i;
+      arg->y = y + j;
+      u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_TPIXEL, arg);
+    }
+}
+
+static void u8g_xform_4tpixel(u8g_t *u8g, u8g_dev_t *chain, const u8g_xform_t *t, u8g_dev_arg_pixel_t *arg) {
+  u8g_uint_t x = arg->x, y = arg->y;
+  uint8_t pixel = arg->pixel;
+  uint8_t dir = arg->dir;
+  uint8_t color = arg->color;
+  uint8_t i;
+
+  if (t->sx == 1 && t->sy == 1) {
+    u8g_xform_block(t, x, y, arg);
+    arg->dir = t->dir[dir];
+    u8g_call_dev_fn(u8g, chain, U8G_DEV_MSG_SET_4TPIXEL, arg);
+    return;
+  }
+
+  for ( i = 0; i < 4; i++ ) {
+    arg->x = x;
+    arg->y = y;
+    arg->color = pixel >> 6;
+    u8g_xform_tpixel(u8g, chain, t, arg);
+    switch (dir) {
+      case 0: x++; break;
+      case 1: y++; break;
+      case 2: x--; break;
+      case 3: y--; break;
+    }
+    pixel <<= 2;
+  }
+  arg->color = color;
+}
+
+static void u8g_xform_8pixel_msg(u8g_t *u8g, u8g_dev_t *chain, const u8g_xform_t *t, u8g_dev_arg_pixel_t *arg) {
+  uint8_t expanded[U8G_SCALE_MAX];
+  uint8_t dir = arg->dir;
+  uint8_t f, n, i, k;
+  u8g_uint_t xs, ys, x, y;
+
+  xs = (u8g_uint_t)(arg->x + t->tx) * t->sx;
+  ys = (u8g_uint_t)(arg->y + t->ty) * t->sy;
+
+  if (t->sx == 1 && t->sy == 1) {
+    u8g_xform_8pixel(u8g, chain, t, arg, xs, ys, dir, arg->pixel);
+    return;
+  }
+
+  // expand along the direction, repeat the expanded pattern for the other axis
+  if ((dir & 1) == 0) {
+    f = t->sx;
+    n = t->sy;
+    if (dir == 2) xs += t->sx - 1;
+  }
+  else {
+    f = t->sy;
+    n = t->sx;
+    if (dir == 3) ys += t->sy - 1;
+  }
+  u8g_xform_expand(arg->pixel, f, expanded);
+
+  for ( i = 0; i < n; i++ ) {
+    x = xs;
+    y = ys;
+    if (dir & 1) x += i; else y += i;
+    for ( k = 0; k < f; k++ ) {
+      if (expanded[k] != 0)
+        u8g_xform_8pixel(u8g, chain, t, arg, x, y, dir, expanded[k]);
+      switch (dir) {
+        case 0: x += 8; break;
+        case 1: y += 8; break;
+        case 2: x -= 8; break;
+        case 3: y -= 8; break;
+      }
+    }
+  }
+}
+
+// convert a box in user coordinates into the coordinates of the next device
+static void u8g_xform_frame_box(const u8g_xform_t *t, const u8g_box_t *box, u8g_box_t *out) {
+  u8g_dev_arg_pixel_t p0, p1;
+  u8g_xform_map(t, (u8g_uint_t)(box->x0 + t->tx) * t->sx, (u8g_uint_t)(box->y0 + t->ty) * t->sy, &p0);
+  u8g_xform_map(t, (u8g_uint_t)(box->x1 + t->tx) * t->sx + t->sx - 1, (u8g_uint_t)(box->y1 + t->ty) * t->sy + t->sy - 1, &p1);
+  out->x0 = p0.x < p1.x ? p0.x : p1.x;
+  out->x1 = p0.x < p1.x ? p1.x : p0.x;
+  out->y0 = p0.y < p1.y ? p0.y : p1.y;
+  out->y1 = p0.y < p1.y ? p1.y : p0.y;
+}
+
+// convert the page box of the next device into user coordinates
+static void u8g_xform_page_box(u8g_xform_t *t, u8g_box_t *box) {
+  u8g_uint_t a0, a1, b0, b1;
+
+  a0 = box->x0; a1 = box->x1;
+  if (t->negx) { a0 = t->dev_w - 1 - box->x1; a1 = t->dev_w - 1 - box->x0; }
+  b0 = box->y0; b1 = box->y1;
+  if (t->negy) { b0 = t->dev_h - 1 - box->y1; b1 = t->dev_h - 1 - box->y0; }
+
+  if (t->swap) {
+    box->x0 = b0 / t->sx - t->tx;
+    box->x1 = b1 / t->sx - t->tx;
+    box->y0 = a0 / t->sy - t->ty;
+    box->y1 = a1 / t->sy - t->ty;
+  }
+  else {
+    box->x0 = a0 / t->sx - t->tx;
+    box->x1 = a1 / t->sx - t->tx;
+    box->y0 = b0 / t->sy - t->ty;
+    box->y1 = b1 / t->sy - t->ty;
+  }
+  // the clip procedures expect x0 <= x1 and y0 <= y1
+  if (box->x0 > box->x1) box->x0 = 0;
+  if (box->y0 > box->y1) box->y0 = 0;
+}
+
+uint8_t u8g_dev_xform_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+  u8g_dev_t *chain = (u8g_dev_t *)(dev->dev_mem);
+  u8g_xform_t *t = &u8g_xform;
+
+  switch (msg) {
+    default:
+      return u8g_call_dev_fn(u8g, chain, msg, arg);
+    case U8G_DEV_MSG_GET_WIDTH:
+      *((u8g_uint_t *)arg) = (t->swap ? u8g_GetHeightLL(u8g, chain) : u8g_GetWidthLL(u8g, chain)) / t->sx;
+      break;
+    case U8G_DEV_MSG_GET_HEIGHT:
+      *((u8g_uint_t *)arg) = (t->swap ? u8g_GetWidthLL(u8g, chain) : u8g_GetHeightLL(u8g, chain)) / t->sy;
+      break;
+    case U8G_DEV_MSG_SET_FRAME_BOX: {
+      u8g_box_t box;
+      t->dev_w = u8g_GetWidthLL(u8g, chain);
+      t->dev_h = u8g_GetHeightLL(u8g, chain);
+      u8g_xform_frame_box(t, (const u8g_box_t *)arg, &box);
+      return u8g_call_dev_fn(u8g, chain, msg, &box);
+    }
+    case U8G_DEV_MSG_GET_PAGE_BOX:
+      // called once per page: fetch everything, which is required for the mapping
+      t->dev_w = u8g_GetWidthLL(u8g, chain);
+      t->dev_h = u8g_GetHeightLL(u8g, chain);
+      u8g_call_dev_fn(u8g, chain, msg, arg);
+      t->page_y0 = ((u8g_box_t *)arg)->y0;
+      t->page_y1 = ((u8g_box_t *)arg)->y1;
+      u8g_xform_page_box(t, (u8g_box_t *)arg);
+      return 1;
+    case U8G_DEV_MSG_SET_PIXEL:
+      u8g_xform_pixel(u8g, chain, t, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_TPIXEL:
+      u8g_xform_tpixel(u8g, chain, t, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_8PIXEL:
+      u8g_xform_8pixel_msg(u8g, chain, t, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_4TPIXEL:
+      u8g_xform_4tpixel(u8g, chain, t, (u8g_dev_arg_pixel_t *)arg);
+      break;
+    case U8G_DEV_MSG_SET_8X8PIXEL:
+      break;    // not supported: blocks are sent as single rows
+    case U8G_DEV_MSG_GET_PB_FNS:
+      break;    // no direct page buffer access, all pixel go through the transformation
+  }
+  return 1;
+}
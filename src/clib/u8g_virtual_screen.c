@@ -35,58 +35,148 @@
 
 #include "u8g.h"
 
-struct _u8g_vs_t {
-  u8g_uint_t x;
-  u8g_uint_t y;
-  u8g_t *u8g;
-};
-typedef struct _u8g_vs_t u8g_vs_t;
-
-#define U8g_VS_MAX 4
-uint8_t u8g_vs_cnt = 0;
-u8g_vs_t u8g_vs_list[U8g_VS_MAX];
-uint8_t u8g_vs_current;
-u8g_uint_t u8g_vs_width;
-u8g_uint_t u8g_vs_height;
+/*
+  Each virtual screen device has its own u8g_vs_t (dev_mem), the tiles are a
+  linked list of caller owned u8g_vs_tile_t nodes, so there is no upper limit.
+
+  Page order is interleaved: page 0 of all tiles, then page 1 of all tiles, ...
+  The transfer of a tile (PAGE_NEXT of the child device) can be started with a
+  user callback (see u8g_SetVirtualScreenFlush). While it is running, the next
+  tile is rendered. Tiles with the same bus id are never transfered at the same time.
+
+  Tiles which share the page buffer (the same u8g_dev_t, e.g. two identical
+  displays with different chip selects) can not be interleaved: such a tile
+  waits until the previous tile with this page buffer has transfered its last
+  page, then it starts with its first page.
+*/
+
+// pool for u8g_AddToVirtualScreen(), u8g_AddTileToVirtualScreen() has no limit
+#ifndef U8g_VS_MAX
+  #define U8g_VS_MAX 4
+#endif
+static u8g_vs_tile_t u8g_vs_pool[U8g_VS_MAX];
+static uint8_t u8g_vs_pool_cnt = 0;
+
+U8G_VS_DEV(u8g_dev_vs);
+
+static uint8_t u8g_vs_call(u8g_vs_tile_t *tile, uint8_t msg, void *arg) {
+  return u8g_call_dev_fn(tile->u8g, tile->u8g->dev, msg, arg);
+}
+
+// transfer the current page of the tile and move to the next page, called by the flush start callback
+void u8g_vs_FlushTile(u8g_vs_tile_t *tile) {
+  tile->result = u8g_vs_call(tile, U8G_DEV_MSG_PAGE_NEXT, NULL);
+}
+
+static void *u8g_vs_pb(u8g_vs_tile_t *tile) {
+  return tile->u8g->dev->dev_mem;
+}
+
+// 1 if a tile in front of "tile" has the same page buffer
+static uint8_t u8g_vs_is_shared(u8g_vs_t *vs, u8g_vs_tile_t *tile) {
+  u8g_vs_tile_t *t;
+  for ( t = vs->first; t != tile; t = t->next )
+    if (u8g_vs_pb(t) == u8g_vs_pb(tile))
+      return 1;
+  return 0;
+}
+
+// all pages of the tile are transfered: the next tile with the same page buffer can start
+static void u8g_vs_done(u8g_vs_tile_t *tile) {
+  u8g_vs_tile_t *t;
+  tile->is_done = 1;
+  for ( t = tile->next; t != NULL; t = t->next ) {
+    if (t->is_waiting && u8g_vs_pb(t) == u8g_vs_pb(tile)) {
+      t->is_waiting = 0;
+      u8g_vs_call(t, U8G_DEV_MSG_PAGE_FIRST, NULL);
+      return;
+    }
+  }
+}
+
+static void u8g_vs_wait(u8g_vs_t *vs, u8g_vs_tile_t *tile) {
+  if (tile->is_pending == 0)
+    return;
+  if (vs->flush_wait != NULL)
+    vs->flush_wait(vs, tile);
+  tile->is_pending = 0;
+  if (tile->result == 0)
+    u8g_vs_done(tile);
+}
+
+static void u8g_vs_flush(u8g_vs_t *vs, u8g_vs_tile_t *tile) {
+  u8g_vs_tile_t *t;
+  if (vs->flush_start == NULL) {
+    u8g_vs_FlushTile(tile);
+    if (tile->result == 0)
+      u8g_vs_done(tile);
+    return;
+  }
+  // one transfer per bus
+  for ( t = vs->first; t != NULL; t = t->next )
+    if (t != tile && t->bus == tile->bus)
+      u8g_vs_wait(vs, t);
+  tile->is_pending = 1;
+  vs->flush_start(vs, tile);
+}
+
+// find the next tile with remaining pages, round robin after "tile"
+static u8g_vs_tile_t *u8g_vs_next(u8g_vs_t *vs, u8g_vs_tile_t *tile) {
+  u8g_vs_tile_t *t = tile;
+  do {
+    t = t->next;
+    if (t == NULL)
+      t = vs->first;
+    u8g_vs_wait(vs, t);
+    if (t->is_done == 0 && t->is_waiting == 0)
+      return t;
+  } while (t != tile);
+  // the last wait may have started a tile with the same page buffer
+  for ( t = vs->first; t != NULL; t = t->next )
+    if (t->is_done == 0 && t->is_waiting == 0)
+      return t;
+  return NULL;
+}
 
 uint8_t u8g_dev_vs_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
+  u8g_vs_t *vs = (u8g_vs_t *)(dev->dev_mem);
+  u8g_vs_tile_t *t;
+  (void)u8g;
   switch (msg) {
-    default: {
-      uint8_t i;
-      for ( i = 0; i < u8g_vs_cnt; i++ ) {
-        u8g_call_dev_fn(u8g_vs_list[i].u8g, u8g_vs_list[i].u8g->dev, msg, arg);
-      }
-    }
+    default:
+      for ( t = vs->first; t != NULL; t = t->next )
+        u8g_vs_call(t, msg, arg);
       return 1;
     case U8G_DEV_MSG_PAGE_FIRST:
-      u8g_vs_current = 0;
-      if (u8g_vs_cnt != 0)
-        return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
-      return 0;
-    case U8G_DEV_MSG_PAGE_NEXT: {
-      uint8_t ret = 0;
-      if (u8g_vs_cnt != 0)
-        ret = u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
-      if (ret != 0)
-        return ret;
-      u8g_vs_current++; // next device
-      if (u8g_vs_current >= u8g_vs_cnt) // reached end?
+      for ( t = vs->first; t != NULL; t = t->next ) {
+        u8g_vs_wait(vs, t);   // in case the last picture loop was aborted
+        t->is_done = 0;
+        t->is_waiting = u8g_vs_is_shared(vs, t);
+        if (t->is_waiting == 0)
+          u8g_vs_call(t, msg, arg);
+      }
+      vs->current = vs->first;
+      return vs->current != NULL;
+    case U8G_DEV_MSG_PAGE_NEXT:
+      if (vs->current == NULL)
         return 0;
-      return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, U8G_DEV_MSG_PAGE_FIRST, arg);
-    }
+      u8g_vs_flush(vs, vs->current);
+      vs->current = u8g_vs_next(vs, vs->current);
+      return vs->current != NULL;
     case U8G_DEV_MSG_GET_WIDTH:
-      *((u8g_uint_t *)arg) = u8g_vs_width;
+      *((u8g_uint_t *)arg) = vs->width;
       break;
     case U8G_DEV_MSG_GET_HEIGHT:
-      *((u8g_uint_t *)arg) = u8g_vs_height;
+      *((u8g_uint_t *)arg) = vs->height;
       break;
     case U8G_DEV_MSG_GET_PAGE_BOX:
-      if (u8g_vs_current < u8g_vs_cnt) {
-        u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
-        ((u8g_box_t *)arg)->x0 += u8g_vs_list[u8g_vs_current].x;
-        ((u8g_box_t *)arg)->x1 += u8g_vs_list[u8g_vs_current].x;
-        ((u8g_box_t *)arg)->y0 += u8g_vs_list[u8g_vs_current].y;
-        ((u8g_box_t *)arg)->y1 += u8g_vs_list[u8g_vs_current].y;
+      t = vs->current;
+      if (t != NULL) {
+        u8g_vs_call(t, msg, arg);
+        ((u8g_box_t *)arg)->x0 += t->x;
+        ((u8g_box_t *)arg)->x1 += t->x;
+        ((u8g_box_t *)arg)->y0 += t->y;
+        ((u8g_box_t *)arg)->y1 += t->y;
       }
       else {
         ((u8g_box_t *)arg)->x0 = 0;
@@ -97,33 +187,90 @@ uint8_t u8g_dev_vs_fn(u8g_t *u8g, u8g_dev_t *dev, uint8_t msg, void *arg) {
       return 1;
     case U8G_DEV_MSG_SET_PIXEL:
     case U8G_DEV_MSG_SET_8PIXEL:
-      if (u8g_vs_current < u8g_vs_cnt) {
-        ((u8g_dev_arg_pixel_t *)arg)->x -= u8g_vs_list[u8g_vs_current].x;
-        ((u8g_dev_arg_pixel_t *)arg)->y -= u8g_vs_list[u8g_vs_current].y;
-        return u8g_call_dev_fn(u8g_vs_list[u8g_vs_current].u8g, u8g_vs_list[u8g_vs_current].u8g->dev, msg, arg);
+      t = vs->current;
+      if (t != NULL) {
+        ((u8g_dev_arg_pixel_t *)arg)->x -= t->x;
+        ((u8g_dev_arg_pixel_t *)arg)->y -= t->y;
+        return u8g_vs_call(t, msg, arg);
       }
       break;
+    case U8G_DEV_MSG_SET_8X8PIXEL:
+      t = vs->current;
+      if (t != NULL) {
+        ((u8g_dev_arg_8x8_t *)arg)->x -= t->x;
+        ((u8g_dev_arg_8x8_t *)arg)->y -= t->y;
+        return u8g_vs_call(t, msg, arg);
+      }
+      break;
+    case U8G_DEV_MSG_GET_PB_FNS:
+      break;    // no direct page buffer access, pixel are translated to the current tile
+    case U8G_DEV_MSG_SET_FRAME_BOX:
+      break;    // tiles always transfer all pages
   }
   return 1;
 }
 
-u8g_dev_t u8g_dev_vs = { u8g_dev_vs_fn, NULL, NULL };
+static u8g_vs_t *u8g_vs_get(u8g_t *vs_u8g) {
+  if (vs_u8g->dev->dev_fn != u8g_dev_vs_fn)
+    return NULL;  // abort if there is no a virtual screen device
+  return (u8g_vs_t *)(vs_u8g->dev->dev_mem);
+}
+
+void u8g_InitVirtualScreenDev(u8g_dev_t *dev, u8g_vs_t *vs) {
+  vs->width = 0;
+  vs->height = 0;
+  vs->first = NULL;
+  vs->current = NULL;
+  vs->flush_start = NULL;
+  vs->flush_wait = NULL;
+  vs->user_ptr = NULL;
+  dev->dev_fn = u8g_dev_vs_fn;
+  dev->dev_mem = vs;
+  dev->com_fn = NULL;
+}
 
 void u8g_SetVirtualScreenDimension(u8g_t *vs_u8g, u8g_uint_t width, u8g_uint_t height) {
-  if (vs_u8g->dev != &u8g_dev_vs)
-    return;   // abort if there is no a virtual screen device
-  u8g_vs_width = width;
-  u8g_vs_height = height;
+  u8g_vs_t *vs = u8g_vs_get(vs_u8g);
+  if (vs == NULL)
+    return;
+  vs->width = width;
+  vs->height = height;
+}
+
+void u8g_SetVirtualScreenFlush(u8g_t *vs_u8g, u8g_vs_flush_fn flush_start, u8g_vs_flush_fn flush_wait, void *user_ptr) {
+  u8g_vs_t *vs = u8g_vs_get(vs_u8g);
+  if (vs == NULL)
+    return;
+  vs->flush_start = flush_start;
+  vs->flush_wait = flush_wait;
+  vs->user_ptr = user_ptr;
+}
+
+uint8_t u8g_AddTileToVirtualScreen(u8g_t *vs_u8g, u8g_vs_tile_t *tile, u8g_uint_t x, u8g_uint_t y, u8g_t *child_u8g, uint8_t bus) {
+  u8g_vs_t *vs = u8g_vs_get(vs_u8g);
+  u8g_vs_tile_t **p;
+  if (vs == NULL)
+    return 0;
+  tile->next = NULL;
+  tile->u8g = child_u8g;
+  tile->x = x;
+  tile->y = y;
+  tile->bus = bus;
+  tile->is_pending = 0;
+  tile->is_done = 1;
+  tile->is_waiting = 0;
+  tile->result = 0;
+  // append, tiles are rendered in the order of the calls
+  for ( p = &(vs->first); *p != NULL; p = &((*p)->next) ) { }
+  *p = tile;
+  return 1;
 }
 
 uint8_t u8g_AddToVirtualScreen(u8g_t *vs_u8g, u8g_uint_t x, u8g_uint_t y, u8g_t *child_u8g) {
-  if (vs_u8g->dev != &u8g_dev_vs)
-    return 0;   // abort if there is no a virtual screen device
-  if (u8g_vs_cnt >= U8g_VS_MAX)
-    return 0;   // maximum number of  child u8g's reached
-  u8g_vs_list[u8g_vs_cnt].u8g = child_u8g;
-  u8g_vs_list[u8g_vs_cnt].x = x;
-  u8g_vs_list[u8g_vs_cnt].y = y;
-  u8g_vs_cnt++;
+  if (u8g_vs_pool_cnt >= U8g_VS_MAX)
+    return 0;   // maximum number of  child u8g's reached, use u8g_AddTileToVirtualScreen()
+  if (u8g_AddTileToVirtualScreen(vs_u8g, u8g_vs_pool + u8g_vs_pool_cnt, x, y, child_u8g, 0) == 0)
+    return 0;
+  u8g_vs_pool_cnt++;
   return 1;
 }
@@ -0,0 +1,270 @@
+/*
+
+  u8g_widget.c
+
+  Retained widgets: a tree of labels, values, icons, bars and lists, each with
+  a box in display coordinates and a dirty flag. Changing a widget only marks
+  it dirty, u8g_DrawWidgets() draws the next frame.
+
+  u8g_DrawWidgets() collects the union of all dirty boxes and restricts the
+  frame to the pages which intersect this union (u8g_FirstPageInBox()). Pages
+  outside of the union are neither rendered nor transferred to the display.
+  A page is always cleared completely, so every visible widget which
+  intersects the page is drawn again, not only the dirty ones.
+
+  Boxes of children are absolute, they are not relative to the parent. A
+  widget is drawn before its children, children are drawn in the order of
+  u8g_AddWidget(). Widgets without draw procedure (u8g_InitWidget()) only
+  group their children. All widgets start dirty: make the root widget as
+  large as the display, so that the first call draws the complete screen.
+
+  Text is drawn with the font of the widget (or the current font, if the
+  widget has no font), the upper edge of the text is the upper edge of the
+  box. The font and the reference position of u8g are restored.
+
+*/
+
+#include "u8g.h"
+
+static void u8g_widget_init(u8g_widget_t *widget, u8g_widget_draw_fn draw_fn, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
+  widget->next = NULL;
+  widget->child = NULL;
+  widget->draw_fn = draw_fn;
+  widget->x = x;
+  widget->y = y;
+  widget->w = w;
+  widget->h = h;
+  widget->flags = U8G_WIDGET_DIRTY;
+  widget->data = NULL;
+  widget->font = NULL;
+  widget->value = 0;
+  widget->max = 0;
+}
+
+static void u8g_widget_draw_label(u8g_t *u8g, u8g_widget_t *widget) {
+  if (widget->data != NULL)
+    u8g_DrawStr(u8g, widget->x, widget->y, (const char *)widget->data);
+}
+
+/* value: right aligned decimal number, followed by the optional suffix in data */
+static void u8g_widget_draw_value(u8g_t *u8g, u8g_widget_t *widget) {
+  char buf[12];
+  char *s = buf + sizeof(buf) - 1;
+  uint32_t v = widget->value < 0 ? -(uint32_t)widget->value : (uint32_t)widget->value;
+  u8g_uint_t w;
+
+  *s = '\0';
+  do {
+    s--;
+    *s = '0' + v % 10;
+    v /= 10;
+  } while (v != 0);
+  if (widget->value < 0) {
+    s--;
+    *s = '-';
+  }
+  w = u8g_GetStrWidth(u8g, s);
+  if (widget->data != NULL)
+    w += u8g_GetStrWidth(u8g, (const char *)widget->data);
+  w = w < widget->w ? widget->w - w : 0;
+  w = widget->x + w;
+  w += u8g_DrawStr(u8g, w, widget->y, s);
+  if (widget->data != NULL)
+    u8g_DrawStr(u8g, w, widget->y, (const char *)widget->data);
+}
+
+static void u8g_widget_draw_icon(u8g_t *u8g, u8g_widget_t *widget) {
+  u8g_sprite_t sprite;
+  u8g_SetSprite(&sprite, (const u8g_pgm_uint8_t *)widget->data, (uint8_t)widget->value, widget->x, widget->y);
+  u8g_DrawSprite(u8g, &sprite);
+}
+
+/* bar: frame, filled proportional to value/max */
+static void u8g_widget_draw_bar(u8g_t *u8g, u8g_widget_t *widget) {
+  int32_t v = widget->value;
+  u8g_uint_t w;
+
+  if (widget->w < 3 || widget->h < 3)
+    return;
+  u8g_DrawFrame(u8g, widget->x, widget->y, widget->w, widget->h);
+  if (v <= 0 || widget->max <= 0)
+    return;
+  if (v > widget->max)
+    v = widget->max;
+  w = (u8g_uint_t)(((uint32_t)v * (widget->w - 2) + (uint32_t)widget->max / 2) / (uint32_t)widget->max);
+  if (w > 0)
+    u8g_DrawBox(u8g, widget->x + 1, widget->y + 1, w, widget->h - 2);
+}
+
+/* list: one line per item, the selected item (value) is inverted and always visible */
+static void u8g_widget_draw_list(u8g_t *u8g, u8g_widget_t *widget) {
+  const char * const *items = (const char * const *)widget->data;
+  u8g_uint_t rh, rows, first, i, y;
+  uint8_t color, hi_color;
+
+  rh = u8g_GetFontAscent(u8g) - u8g_GetFontDescent(u8g) + 1;
+  if (items == NULL || rh == 0 || widget->max <= 0)
+    return;
+  rows = widget->h / rh;
+  if (rows == 0)
+    return;
+  first = 0;
+  if (widget->value >= (int32_t)rows)
+    first = widget->value - rows + 1;
+
+  color = u8g->arg_pixel.color;
+  hi_color = u8g->arg_pixel.hi_color;
+  y = widget->y;
+  for ( i = first; i < first + rows && (int32_t)i < widget->max; i++ ) {
+    if (u8g_IsBBXIntersection(u8g, widget->x, y, widget->w, rh) != 0) {
+      if ((int32_t)i == widget->value) {
+        u8g_DrawBox(u8g, widget->x, y, widget->w, rh);
+        u8g_SetDefaultBackgroundColor(u8g);
+        u8g_DrawStr(u8g, widget->x + 1, y, items[i]);
+        u8g->arg_pixel.color = color;
+        u8g->arg_pixel.hi_color = hi_color;
+      }
+      else {
+        u8g_DrawStr(u8g, widget->x + 1, y, items[i]);
+      }
+    }
+    y += rh;
+  }
+}
+
+void u8g_InitWidget(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h) {
+  u8g_widget_init(widget, (u8g_widget_draw_fn)NULL, x, y, w, h);
+}
+
+void u8g_InitLabel(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char *s) {
+  u8g_widget_init(widget, u8g_widget_draw_label, x, y, w, h);
+  widget->font = font;
+  widget->data = s;
+}
+
+void u8g_InitValue(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char *suffix) {
+  u8g_widget_init(widget, u8g_widget_draw_value, x, y, w, h);
+  widget->font = font;
+  widget->data = suffix;
+}
+
+void u8g_InitIcon(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, const u8g_pgm_uint8_t *atlas, uint8_t idx) {
+  u8g_widget_init(widget, u8g_widget_draw_icon, x, y, (u8g_uint_t)u8g_pgm_read(atlas) * 8, u8g_pgm_read(atlas + 1));
+  widget->data = atlas;
+  widget->value = idx;
+}
+
+void u8g_InitBar(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, int32_t max) {
+  u8g_widget_init(widget, u8g_widget_draw_bar, x, y, w, h);
+  widget->max = max;
+}
+
+void u8g_InitList(u8g_widget_t *widget, u8g_uint_t x, u8g_uint_t y, u8g_uint_t w, u8g_uint_t h, const u8g_fntpgm_uint8_t *font, const char * const *items, uint8_t cnt) {
+  u8g_widget_init(widget, u8g_widget_draw_list, x, y, w, h);
+  widget->font = font;
+  widget->data = items;
+  widget->max = cnt;
+}
+
+/* append child to the children of parent */
+void u8g_AddWidget(u8g_widget_t *parent, u8g_widget_t *child) {
+  u8g_widget_t **p = &(parent->child);
+  while (*p != NULL)
+    p = &((*p)->next);
+  child->next = NULL;
+  *p = child;
+  child->flags |= U8G_WIDGET_DIRTY;
+}
+
+void u8g_InvalidateWidget(u8g_widget_t *widget) {
+  widget->flags |= U8G_WIDGET_DIRTY;
+}
+
+/* value of a value, bar or list (selected item) widget or the sprite of an icon */
+void u8g_SetWidgetValue(u8g_widget_t *widget, int32_t value) {
+  if (widget->value == value)
+    return;
+  widget->value = value;
+  widget->flags |= U8G_WIDGET_DIRTY;
+}
+
+/* text of a label, suffix of a value: a new text at the same address needs u8g_InvalidateWidget() */
+void u8g_SetWidgetText(u8g_widget_t *widget, const char *s) {
+  if (widget->data == s)
+    return;
+  widget->data = s;
+  widget->flags |= U8G_WIDGET_DIRTY;
+}
+
+void u8g_SetWidgetVisible(u8g_widget_t *widget, uint8_t is_visible) {
+  uint8_t hidden = is_visible == 0 ? U8G_WIDGET_HIDDEN : 0;
+  if ((widget->flags & U8G_WIDGET_HIDDEN) == hidden)
+    return;
+  widget->flags &= ~U8G_WIDGET_HIDDEN;
+  widget->flags |= hidden | U8G_WIDGET_DIRTY;
+}
+
+/* union of the dirty boxes, hidden widgets included: their area must be cleared */
+static void u8g_widget_get_dirty(u8g_widget_t *widget, u8g_box_t *box, uint8_t *is_dirty) {
+  for ( ; widget != NULL; widget = widget->next ) {
+    if ((widget->flags & U8G_WIDGET_DIRTY) != 0 && widget->w != 0 && widget->h != 0) {
+      if (*is_dirty == 0 || box->x0 > widget->x)
+        box->x0 = widget->x;
+      if (*is_dirty == 0 || box->y0 > widget->y)
+        box->y0 = widget->y;
+      if (*is_dirty == 0 || box->x1 < widget->x + widget->w - 1)
+        box->x1 = widget->x + widget->w - 1;
+      if (*is_dirty == 0 || box->y1 < widget->y + widget->h - 1)
+        box->y1 = widget->y + widget->h - 1;
+      *is_dirty = 1;
+    }
+    u8g_widget_get_dirty(widget->child, box, is_dirty);
+  }
+}
+
+// font: the current font of u8g_DrawWidgets(), used by widgets without a font
+static void u8g_widget_draw(u8g_t *u8g, u8g_widget_t *widget, const u8g_pgm_uint8_t *font) {
+  for ( ; widget != NULL; widget = widget->next ) {
+    if ((widget->flags & U8G_WIDGET_HIDDEN) != 0)
+      continue;
+    if (widget->draw_fn != NULL && u8g_IsBBXIntersection(u8g, widget->x, widget->y, widget->w, widget->h) != 0) {
+      if (widget->font != NULL)
+        u8g_SetFont(u8g, widget->font);
+      else if (font != NULL)
+        u8g_SetFont(u8g, font);
+      u8g_SetFontPosTop(u8g);
+      widget->draw_fn(u8g, widget);
+    }
+    u8g_widget_draw(u8g, widget->child, font);
+  }
+}
+
+static void u8g_widget_clear_dirty(u8g_widget_t *widget) {
+  for ( ; widget != NULL; widget = widget->next ) {
+    widget->flags &= ~U8G_WIDGET_DIRTY;
+    u8g_widget_clear_dirty(widget->child);
+  }
+}
+
+/* draw the pages which intersect dirty widgets, returns 0 if no widget was dirty */
+uint8_t u8g_DrawWidgets(u8g_t *u8g, u8g_widget_t *root) {
+  const u8g_pgm_uint8_t *font = u8g->font;
+  u8g_font_calc_vref_fnptr font_calc_vref = u8g->font_calc_vref;
+  u8g_box_t box;
+  uint8_t is_dirty = 0;
+
+  u8g_widget_get_dirty(root, &box, &is_dirty);
+  if (is_dirty == 0)
+    return 0;
+
+  u8g_FirstPageInBox(u8g, box.x0, box.y0, box.x1 - box.x0 + 1, box.y1 - box.y0 + 1);
+  do {
+    u8g_widget_draw(u8g, root, font);
+  } while (u8g_NextPage(u8g));
+
+  if (font != NULL)
+    u8g_SetFont(u8g, font);
+  u8g->font_calc_vref = font_calc_vref;
+  u8g_widget_clear_dirty(root);
+  return 1;
+}